@@ -0,0 +1,63 @@
+/*
+  ==============================================================================
+
+    Benchmark.h
+    Shared helpers for the AnalogChannelBenchmarks console app
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    Each benchmark is a juce::UnitTest in Benchmark::category: it logs what
+    it measured and expects its budget. Wall-clock budgets are checked on
+    medians of repeated runs, so one preempted run doesn't fail them.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <vector>
+
+//==============================================================================
+namespace Benchmark
+{
+    static constexpr const char* category = "AnalogChannel Benchmarks";
+
+    /** Milliseconds spent in function. */
+    template <typename Function>
+    double timeMs (Function&& function)
+    {
+        const double startMs = juce::Time::getMillisecondCounterHiRes();
+        function();
+        return juce::Time::getMillisecondCounterHiRes() - startMs;
+    }
+
+    /** Median of the values (taken by value: sorted in place). */
+    inline double median (std::vector<double> values)
+    {
+        jassert (! values.empty());
+        std::sort (values.begin(), values.end());
+        const size_t middle = values.size() / 2;
+        return (values.size() % 2) != 0 ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+    }
+
+    /** Median time of numRuns calls of function, in milliseconds. */
+    template <typename Function>
+    double medianTimeMs (int numRuns, Function&& function)
+    {
+        std::vector<double> times;
+        times.reserve (static_cast<size_t> (numRuns));
+
+        for (int i = 0; i < numRuns; ++i)
+            times.push_back (timeMs (function));
+
+        return median (std::move (times));
+    }
+
+    inline juce::String formatMs (double milliseconds)
+    {
+        return juce::String (milliseconds, 3) + " ms";
+    }
+}
@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    BenchmarkMain.cpp
+    AnalogChannelBenchmarks console app
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    Runs every juce::UnitTest in the "AnalogChannel Benchmarks" category (or
+    only those whose name contains the first argument). Reports go to the
+    log; a budget that isn't met is a failed expectation, and the exit code
+    is the number of failures, so ctest sees them.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "Benchmark.h"
+
+int main (int argc, char* argv[])
+{
+    // The processor is an AsyncUpdater and owns editor-side helpers: it needs
+    // the message manager even without a window
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const juce::String filter = argc > 1 ? juce::String (argv[1]) : juce::String();
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure (false);
+
+    juce::Array<juce::UnitTest*> tests;
+
+    for (auto* test : juce::UnitTest::getTestsInCategory (Benchmark::category))
+        if (filter.isEmpty() || test->getName().containsIgnoreCase (filter))
+            tests.add (test);
+
+    runner.runTests (tests);
+
+    int failures = 0;
+
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        failures += runner.getResult (i)->failures;
+
+    return failures;
+}
@@ -0,0 +1,136 @@
+/*
+  ==============================================================================
+
+    BlockKernelsBenchmark.cpp
+    Selected kernel variant, its results against plain loops, and its speed
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "BlockKernels.h"
+#include <cmath>
+
+//==============================================================================
+class BlockKernelsBenchmark : public juce::UnitTest
+{
+public:
+    BlockKernelsBenchmark() : juce::UnitTest ("Block kernels", Benchmark::category) {}
+
+    void runTest() override
+    {
+        beginTest ("Variant");
+        logMessage ("Selected variant: " + juce::String (BlockKernels::getVariantName()));
+
+        juce::Random random (0x5eed);
+        std::vector<float> a (blockSize), b (blockSize);
+        std::vector<double> d (blockSize);
+
+        for (int i = 0; i < blockSize; ++i)
+        {
+            a[(size_t) i] = random.nextFloat() * 2.0f - 1.0f;
+            b[(size_t) i] = random.nextFloat() * 2.0f - 1.0f;
+            d[(size_t) i] = random.nextDouble() * 2.0 - 1.0;
+        }
+
+        beginTest ("Results against plain loops");
+
+        // Every block length up to the widest vector plus a tail, so each variant's tail path runs
+        for (int num = 0; num <= 40; ++num)
+        {
+            expectWithinAbsoluteError (BlockKernels::dotProduct (a.data(), b.data(), num), plainDotProduct (a.data(), b.data(), num), 1.0e-4f);
+            expectWithinAbsoluteError (BlockKernels::sumOfSquares (a.data(), num), plainSumOfSquares (a.data(), num), 1.0e-4f);
+            expectWithinAbsoluteError (BlockKernels::sumOfAbsolutes (a.data(), num), plainSumOfAbsolutes (a.data(), num), 1.0e-4f);
+            expectEquals (BlockKernels::findPeak (a.data(), num), plainFindPeak (a.data(), num));
+            expectWithinAbsoluteError (BlockKernels::sumOfSquares (d.data(), num), plainSumOfSquares (d.data(), num), 1.0e-12);
+            expectEquals (BlockKernels::findPeak (d.data(), num), plainFindPeak (d.data(), num));
+        }
+
+        beginTest ("Speed (" + juce::String (blockSize) + " samples per call)");
+
+        report ("dotProduct",            [&] { return BlockKernels::dotProduct (a.data(), b.data(), blockSize); },
+                                         [&] { return plainDotProduct (a.data(), b.data(), blockSize); });
+        report ("sumOfSquares",          [&] { return BlockKernels::sumOfSquares (a.data(), blockSize); },
+                                         [&] { return plainSumOfSquares (a.data(), blockSize); });
+        report ("sumOfAbsolutes",        [&] { return BlockKernels::sumOfAbsolutes (a.data(), blockSize); },
+                                         [&] { return plainSumOfAbsolutes (a.data(), blockSize); });
+        report ("findPeak",              [&] { return BlockKernels::findPeak (a.data(), blockSize); },
+                                         [&] { return plainFindPeak (a.data(), blockSize); });
+        report ("sumOfSquares (double)", [&] { return (float) BlockKernels::sumOfSquares (d.data(), blockSize); },
+                                         [&] { return (float) plainSumOfSquares (d.data(), blockSize); });
+        report ("findPeak (double)",     [&] { return (float) BlockKernels::findPeak (d.data(), blockSize); },
+                                         [&] { return (float) plainFindPeak (d.data(), blockSize); });
+    }
+
+private:
+    //==============================================================================
+    template <typename Kernel, typename Plain>
+    void report (const juce::String& name, Kernel&& kernel, Plain&& plain)
+    {
+        const double kernelNs = nanosecondsPerCall (kernel);
+        const double plainNs = nanosecondsPerCall (plain);
+
+        logMessage (name.paddedRight (' ', 24) + juce::String (kernelNs, 1) + " ns (plain loop "
+                    + juce::String (plainNs, 1) + " ns, x" + juce::String (plainNs / kernelNs, 2) + ")");
+    }
+
+    template <typename Function>
+    double nanosecondsPerCall (Function&& function)
+    {
+        float sink = 0.0f;
+        const double ms = Benchmark::medianTimeMs (numRuns, [&]
+        {
+            for (int i = 0; i < callsPerRun; ++i)
+                sink += function();
+        });
+
+        resultSink = sink;
+        return ms * 1.0e6 / callsPerRun;
+    }
+
+    // The plain loops the kernels replace (the compiler may still vectorise them)
+    static float plainDotProduct (const float* x, const float* y, int num)
+    {
+        float sum = 0.0f;
+        for (int i = 0; i < num; ++i)
+            sum += x[i] * y[i];
+        return sum;
+    }
+
+    template <typename SampleType>
+    static SampleType plainSumOfSquares (const SampleType* x, int num)
+    {
+        SampleType sum = 0;
+        for (int i = 0; i < num; ++i)
+            sum += x[i] * x[i];
+        return sum;
+    }
+
+    static float plainSumOfAbsolutes (const float* x, int num)
+    {
+        float sum = 0.0f;
+        for (int i = 0; i < num; ++i)
+            sum += std::abs (x[i]);
+        return sum;
+    }
+
+    template <typename SampleType>
+    static SampleType plainFindPeak (const SampleType* x, int num)
+    {
+        SampleType peak = 0;
+        for (int i = 0; i < num; ++i)
+            peak = juce::jmax (peak, std::abs (x[i]));
+        return peak;
+    }
+
+    static constexpr int blockSize = 512;
+    static constexpr int numRuns = 21;
+    static constexpr int callsPerRun = 2000;
+
+    volatile float resultSink = 0.0f;   // Keeps the timed calls from being optimised away
+};
+
+static BlockKernelsBenchmark blockKernelsBenchmark;
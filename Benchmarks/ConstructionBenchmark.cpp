@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    ConstructionBenchmark.cpp
+    Processor construction time (hosts pay it on every scan and session load)
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "PluginProcessor.h"
+
+//==============================================================================
+class ConstructionBenchmark : public juce::UnitTest
+{
+public:
+    ConstructionBenchmark() : juce::UnitTest ("Processor construction", Benchmark::category) {}
+
+    void runTest() override
+    {
+        beginTest ("Construction time");
+
+        // One untimed instance first: static tables, module singletons
+        std::make_unique<AnalogChannelAudioProcessor>().reset();
+
+        // The whole object, base class and bus setup included; destruction isn't timed
+        std::vector<double> times;
+
+        for (int i = 0; i < numRuns; ++i)
+        {
+            std::unique_ptr<AnalogChannelAudioProcessor> processor;
+            times.push_back (Benchmark::timeMs ([&] { processor = std::make_unique<AnalogChannelAudioProcessor>(); }));
+        }
+
+        const double constructionMs = Benchmark::median (std::move (times));
+
+        logMessage ("Median of " + juce::String (numRuns) + " constructions: "
+                    + Benchmark::formatMs (constructionMs) + ", budget " + Benchmark::formatMs (budgetMs));
+
+        expectLessOrEqual (constructionMs, budgetMs, "construction is over budget");
+    }
+
+private:
+    static constexpr int numRuns = 51;
+    static constexpr double budgetMs = 2.0;
+};
+
+static ConstructionBenchmark constructionBenchmark;
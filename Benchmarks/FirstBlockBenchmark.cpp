@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    FirstBlockBenchmark.cpp
+    Cost of the first block after prepareToPlay against the steady state
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    prepareToPlay primes the chain (one silent block, then a state reset), so
+    the first real block should not pay for allocations, page faults or
+    coefficient builds the priming missed.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "PluginProcessor.h"
+#include <cmath>
+
+//==============================================================================
+class FirstBlockBenchmark : public juce::UnitTest
+{
+public:
+    FirstBlockBenchmark() : juce::UnitTest ("First block after prepareToPlay", Benchmark::category) {}
+
+    void runTest() override
+    {
+        beginTest ("Float processing");
+        measure<float> (juce::AudioProcessor::singlePrecision);
+
+        beginTest ("Double processing");
+        measure<double> (juce::AudioProcessor::doublePrecision);
+    }
+
+private:
+    //==============================================================================
+    template <typename SampleType>
+    void measure (juce::AudioProcessor::ProcessingPrecision precision)
+    {
+        // One fresh instance per run: only the first block after prepareToPlay counts
+        std::vector<double> firstBlockTimes, steadyStateTimes;
+
+        for (int run = 0; run < numInstances; ++run)
+        {
+            AnalogChannelAudioProcessor processor;
+            processor.setProcessingPrecision (precision);
+            processor.prepareToPlay (sampleRate, blockSize);
+
+            // -20dBFS sine, so the dynamics and saturation paths run
+            juce::AudioBuffer<SampleType> block (2, blockSize);
+            juce::MidiBuffer midi;
+            double phase = 0.0;
+
+            auto timeBlock = [&]
+            {
+                for (int i = 0; i < blockSize; ++i, phase += phaseIncrement)
+                {
+                    const auto sample = static_cast<SampleType> (0.1 * std::sin (phase));
+                    block.setSample (0, i, sample);
+                    block.setSample (1, i, sample);
+                }
+
+                return Benchmark::timeMs ([&] { processor.processBlock (block, midi); });
+            };
+
+            firstBlockTimes.push_back (timeBlock());
+
+            for (int i = 0; i < steadyStateBlocks; ++i)
+                steadyStateTimes.push_back (timeBlock());
+
+            processor.releaseResources();
+        }
+
+        const double firstBlockMs = Benchmark::median (std::move (firstBlockTimes));
+        const double steadyStateMs = Benchmark::median (std::move (steadyStateTimes));
+
+        logMessage ("First block " + Benchmark::formatMs (firstBlockMs) + ", steady state " + Benchmark::formatMs (steadyStateMs)
+                    + " (medians, " + juce::String (blockSize) + " samples at " + juce::String (sampleRate, 0) + " Hz)");
+
+        // Something the first block still builds or faults in that priming missed
+        expectLessOrEqual (firstBlockMs, budget * steadyStateMs, "the first block costs more than the budget allows");
+    }
+
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 512;
+    static constexpr int numInstances = 15;
+    static constexpr int steadyStateBlocks = 32;
+    static constexpr double phaseIncrement = juce::MathConstants<double>::twoPi / 64.0;
+
+    // First-block cost as a multiple of the steady-state cost
+    static constexpr double budget = 1.5;
+};
+
+static FirstBlockBenchmark firstBlockBenchmark;
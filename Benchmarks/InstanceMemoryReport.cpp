@@ -0,0 +1,56 @@
+/*
+  ==============================================================================
+
+    InstanceMemoryReport.cpp
+    Per-instance memory: processor object, allocated algorithm state, scratch
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "PluginProcessor.h"
+
+//==============================================================================
+class InstanceMemoryReport : public juce::UnitTest
+{
+public:
+    InstanceMemoryReport() : juce::UnitTest ("Instance memory", Benchmark::category) {}
+
+    void runTest() override
+    {
+        beginTest ("Bytes per instance");
+
+        AnalogChannelAudioProcessor processor;
+        const size_t constructedBytes = processor.getInstanceStateBytes();
+
+        processor.prepareToPlay (sampleRate, blockSize);
+        const size_t realtimeBytes = processor.getInstanceStateBytes();
+
+        // A render holds every algorithm's state (prepareToPlay allocates it)
+        processor.setNonRealtime (true);
+        processor.prepareToPlay (sampleRate, blockSize);
+        const size_t offlineBytes = processor.getInstanceStateBytes();
+
+        processor.setNonRealtime (false);
+        processor.prepareToPlay (sampleRate, blockSize);
+        const size_t afterRenderBytes = processor.getInstanceStateBytes();
+
+        logMessage ("Constructed:       " + juce::String ((juce::int64) constructedBytes) + " bytes");
+        logMessage ("Prepared (48kHz):  " + juce::String ((juce::int64) realtimeBytes) + " bytes");
+        logMessage ("Offline render:    " + juce::String ((juce::int64) offlineBytes) + " bytes");
+        logMessage ("After the render:  " + juce::String ((juce::int64) afterRenderBytes) + " bytes");
+
+        // Only the selected algorithms hold state outside a render
+        expectGreaterThan (offlineBytes, realtimeBytes, "a render should allocate the unselected algorithms");
+        expectEquals (afterRenderBytes, realtimeBytes, "leaving the render should free them again");
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 512;
+};
+
+static InstanceMemoryReport instanceMemoryReport;
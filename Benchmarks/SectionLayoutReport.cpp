@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    SectionLayoutReport.cpp
+    Per-lane section layout: object size, hot state, config, allocated state
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "Sections/PreInputSection.h"
+#include "Sections/FilterSection.h"
+#include "Sections/ControlCompSection.h"
+#include "Sections/LowDynamicSection.h"
+#include "Sections/EQSection.h"
+#include "Sections/StyleCompSection.h"
+#include "Sections/ConsoleSection.h"
+#include "Sections/OutStageSection.h"
+#include "Sections/VolumeSection.h"
+
+//==============================================================================
+class SectionLayoutReport : public juce::UnitTest
+{
+public:
+    SectionLayoutReport() : juce::UnitTest ("Section layout", Benchmark::category) {}
+
+    void runTest() override
+    {
+        beginTest ("Bytes and cache lines per lane");
+
+        logMessage (juce::String ("Section").paddedRight (' ', 14)
+                    + juce::String ("object").paddedRight (' ', 18)
+                    + juce::String ("hot state").paddedRight (' ', 18)
+                    + juce::String ("config").paddedRight (' ', 10)
+                    + "allocated");
+
+        // Multi-algorithm sections hold their default algorithm's state once prepared
+        PreInputSection preInput;
+        prepare (preInput);
+        preInput.updateAlgorithmStates (PreInputSection::Pure);
+        report<PreInputSection> ("PreInput", preInput.getStateBytes() - sizeof (PreInputSection));
+
+        report<FilterSection> ("Filters", 0);
+        report<ControlCompSection> ("ControlComp", 0);
+        report<LowDynamicSection> ("LowDynamic", 0);
+        report<EQSection> ("EQ", 0);
+
+        StyleCompSection styleComp;
+        prepare (styleComp);
+        styleComp.updateAlgorithmStates (StyleCompSection::Warm);
+        report<StyleCompSection> ("StyleComp", styleComp.getStateBytes() - sizeof (StyleCompSection));
+
+        ConsoleSection console;
+        prepare (console);
+        report<ConsoleSection> ("Console", console.getStateBytes() - sizeof (ConsoleSection));
+
+        OutStageSection outStage;
+        prepare (outStage);
+        report<OutStageSection> ("OutStage", outStage.getStateBytes() - sizeof (OutStageSection));
+
+        report<VolumeSection> ("Volume", 0);
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr size_t cacheLine = 64;
+
+    static size_t toLines (size_t bytes)    { return (bytes + cacheLine - 1) / cacheLine; }
+
+    static juce::String bytesAndLines (size_t bytes)
+    {
+        return juce::String ((juce::int64) bytes) + " (" + juce::String ((juce::int64) toLines (bytes)) + " lines)";
+    }
+
+    static void prepare (BypassableSection& section)
+    {
+        section.setSampleRate (sampleRate);
+        section.reset();
+    }
+
+    template <typename SectionType>
+    void report (const char* name, size_t allocatedBytes)
+    {
+        logMessage (juce::String (name).paddedRight (' ', 14)
+                    + bytesAndLines (sizeof (SectionType)).paddedRight (' ', 18)
+                    + bytesAndLines (SectionType::getHotStateBytes()).paddedRight (' ', 18)
+                    + juce::String ((juce::int64) SectionType::getConfigBytes()).paddedRight (' ', 10)
+                    + juce::String ((juce::int64) allocatedBytes));
+
+        // Whole lines per lane, so the L and R instances of a [2] array never share one
+        expectEquals ((int) (sizeof (SectionType) % cacheLine), 0, juce::String (name) + " should fill whole cache lines");
+        expect (SectionType::getHotStateBytes() + SectionType::getConfigBytes() <= sizeof (SectionType));
+    }
+};
+
+static SectionLayoutReport sectionLayoutReport;
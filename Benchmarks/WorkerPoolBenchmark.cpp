@@ -0,0 +1,129 @@
+/*
+  ==============================================================================
+
+    WorkerPoolBenchmark.cpp
+    WorkerPool stress test and thread scaling
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    The processor hands the pool two task groups (L and R). This harness
+    drives it harder: jobs of 3 to 16 groups back to back, each task checked
+    to run exactly once per job, and the same DSP load timed on 1 to N
+    threads.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "WorkerPool.h"
+
+//==============================================================================
+class WorkerPoolBenchmark : public juce::UnitTest
+{
+public:
+    WorkerPoolBenchmark() : juce::UnitTest ("Worker pool", Benchmark::category) {}
+
+    void runTest() override
+    {
+        const int maxThreads = juce::jlimit (1, maxScalingThreads, juce::SystemStats::getNumCpus());
+
+        beginTest ("Stress: every task runs once per job");
+
+        for (int numWorkers : { 1, 3, maxThreads - 1 })
+            if (numWorkers > 0)
+                stress (numWorkers);
+
+        beginTest ("Scaling: " + juce::String (numScalingGroups) + " task groups on 1 to " + juce::String (maxThreads) + " threads");
+
+        double singleThreadMs = 0.0;
+
+        for (int numThreads = 1; numThreads <= maxThreads; ++numThreads)
+        {
+            const double jobMs = timeJob (numThreads - 1);
+
+            if (numThreads == 1)
+                singleThreadMs = jobMs;
+
+            logMessage (juce::String (numThreads) + " thread(s): " + Benchmark::formatMs (jobMs)
+                        + " per job, x" + juce::String (singleThreadMs / jobMs, 2));
+        }
+    }
+
+private:
+    //==============================================================================
+    void stress (int numWorkers)
+    {
+        WorkerPool pool;
+        pool.prepare (numWorkers, blockPeriodMs);
+
+        int runCounts[maxStressGroups] {};
+        int numBadJobs = 0;
+
+        auto task = [&] (int index) { ++runCounts[index]; };
+
+        for (int job = 0; job < numStressJobs; ++job)
+        {
+            const int numTasks = 3 + job % (maxStressGroups - 2);
+            pool.run (numTasks, task);
+
+            // run() has returned: every task of the job must have run exactly once
+            bool isJobValid = true;
+
+            for (int i = 0; i < maxStressGroups; ++i)
+            {
+                isJobValid = isJobValid && runCounts[i] == (i < numTasks ? 1 : 0);
+                runCounts[i] = 0;
+            }
+
+            if (! isJobValid)
+                ++numBadJobs;
+        }
+
+        pool.release();
+
+        logMessage (juce::String (numWorkers) + " worker(s): " + juce::String (numStressJobs) + " jobs of 3 to "
+                    + juce::String (maxStressGroups) + " tasks, " + juce::String (numBadJobs) + " with a missed or repeated task");
+
+        expectEquals (numBadJobs, 0, "a task was missed or ran twice");
+    }
+
+    double timeJob (int numWorkers)
+    {
+        WorkerPool pool;
+        pool.prepare (numWorkers, blockPeriodMs);
+
+        // One buffer per group, filtered in place (a serial recursion, like the sections)
+        std::vector<std::vector<float>> buffers (numScalingGroups, std::vector<float> (samplesPerGroup, 0.5f));
+
+        auto task = [&] (int index)
+        {
+            auto& buffer = buffers[(size_t) index];
+            float state = 0.0f;
+
+            for (int pass = 0; pass < passesPerTask; ++pass)
+                for (auto& sample : buffer)
+                    sample = state = 0.99f * state + 0.01f * sample;
+        };
+
+        pool.run (numScalingGroups, task);  // Workers up and spinning
+
+        const double jobMs = Benchmark::medianTimeMs (numScalingJobs, [&] { pool.run (numScalingGroups, task); });
+
+        pool.release();
+        return jobMs;
+    }
+
+    static constexpr double blockPeriodMs = 10.0;
+
+    static constexpr int maxStressGroups = 16;
+    static constexpr int numStressJobs = 20000;
+
+    static constexpr int maxScalingThreads = 8;
+    static constexpr int numScalingGroups = 8;
+    static constexpr int numScalingJobs = 31;
+    static constexpr int samplesPerGroup = 4096;
+    static constexpr int passesPerTask = 16;
+};
+
+static WorkerPoolBenchmark workerPoolBenchmark;
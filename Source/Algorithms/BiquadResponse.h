@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+
+    BiquadResponse.h
+    Analytic frequency response of biquads, for the GUI's response curves
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    Evaluates H(e^jw) of normalised biquads
+        H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+    over a fixed set of frequencies. The sines and cosines of the points are
+    computed once per frequency set / sample rate; each evaluation is then a
+    plain multiply-add loop over the points (no transcendental functions, so
+    the compiler vectorises it).
+
+    step = 2 evaluates H(z^2): a filter whose state alternates between two
+    copies on odd and even samples (Airwindows' "flip" biquads).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <vector>
+
+//==============================================================================
+class BiquadResponse
+{
+public:
+    static constexpr int maxStep = 2;
+
+    BiquadResponse() = default;
+
+    //==============================================================================
+    /** Sets the evaluation frequencies (Hz) and the sample rate they are evaluated at. */
+    void setFrequencies (const double* frequenciesHz, int numPointsToUse, double newSampleRate)
+    {
+        numPoints = juce::jmax (0, numPointsToUse);
+        sampleRate = newSampleRate;
+
+        for (int k = 0; k < 2 * maxStep; ++k)
+        {
+            cosines[k].resize (static_cast<size_t> (numPoints));
+            sines[k].resize (static_cast<size_t> (numPoints));
+        }
+
+        for (int i = 0; i < numPoints; ++i)
+        {
+            const double w = juce::MathConstants<double>::twoPi * frequenciesHz[i] / sampleRate;
+
+            for (int k = 0; k < 2 * maxStep; ++k)
+            {
+                cosines[k][static_cast<size_t> (i)] = std::cos ((k + 1) * w);
+                sines[k][static_cast<size_t> (i)] = std::sin ((k + 1) * w);
+            }
+        }
+    }
+
+    int getNumPoints() const { return numPoints; }
+    double getSampleRate() const { return sampleRate; }
+
+    //==============================================================================
+    /** Multiplies |H| into magnitudes (linear). */
+    void multiplyMagnitude (double b0, double b1, double b2, double a1, double a2,
+                            double* magnitudes, int step = 1) const
+    {
+        // |N|^2 = b0^2 + b1^2 + b2^2 + 2 (b0 b1 + b1 b2) cos w + 2 b0 b2 cos 2w,
+        // same for the denominator with (1, a1, a2)
+        const double* cos1 = cosines[step - 1].data();
+        const double* cos2 = cosines[2 * step - 1].data();
+
+        const double n0 = b0 * b0 + b1 * b1 + b2 * b2, n1 = 2.0 * (b0 * b1 + b1 * b2), n2 = 2.0 * b0 * b2;
+        const double d0 = 1.0 + a1 * a1 + a2 * a2,     d1 = 2.0 * (a1 + a1 * a2),      d2 = 2.0 * a2;
+
+        for (int i = 0; i < numPoints; ++i)
+        {
+            const double numerator = n0 + n1 * cos1[i] + n2 * cos2[i];
+            const double denominator = d0 + d1 * cos1[i] + d2 * cos2[i];
+            magnitudes[i] *= std::sqrt (juce::jmax (0.0, numerator) / juce::jmax (1.0e-30, denominator));
+        }
+    }
+
+    /** Multiplies |H| of a JUCE biquad into magnitudes. */
+    template <typename NumericType>
+    void multiplyMagnitude (const juce::dsp::IIR::Coefficients<NumericType>& coefficients, double* magnitudes) const
+    {
+        jassert (coefficients.getFilterOrder() == 2);
+        const auto* c = coefficients.getRawCoefficients();  // b0 b1 b2 a1 a2 (a0 = 1)
+
+        multiplyMagnitude (c[0], c[1], c[2], c[3], c[4], magnitudes);
+    }
+
+    /** Adds gain * H (complex) into real / imag, for filters that sum parallel paths. */
+    void addResponse (double gain, double b0, double b1, double b2, double a1, double a2,
+                      double* real, double* imag, int step = 1) const
+    {
+        const double* cos1 = cosines[step - 1].data();
+        const double* cos2 = cosines[2 * step - 1].data();
+        const double* sin1 = sines[step - 1].data();
+        const double* sin2 = sines[2 * step - 1].data();
+
+        for (int i = 0; i < numPoints; ++i)
+        {
+            // e^-jw = cos w - j sin w
+            const double nr = b0 + b1 * cos1[i] + b2 * cos2[i];
+            const double ni = -(b1 * sin1[i] + b2 * sin2[i]);
+            const double dr = 1.0 + a1 * cos1[i] + a2 * cos2[i];
+            const double di = -(a1 * sin1[i] + a2 * sin2[i]);
+
+            const double scale = gain / juce::jmax (1.0e-30, dr * dr + di * di);
+            real[i] += (nr * dr + ni * di) * scale;
+            imag[i] += (ni * dr - nr * di) * scale;
+        }
+    }
+
+private:
+    //==============================================================================
+    int numPoints = 0;
+    double sampleRate = 44100.0;
+    std::vector<double> cosines[2 * maxStep], sines[2 * maxStep];  // [k - 1]: cos / sin (k w)
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BiquadResponse)
+};
@@ -17,21 +17,41 @@
     Optical compressor with smooth, warm, musical compression.
     Fixed parameters for AnalogChannel: Ratio 6:1, Fixed A/R mode, Output 0dB
 
+    Above ~72kHz the feedback detector runs decimated (see SidechainDecimator.h);
+    the post-EQ stays at full rate.
+
   ==============================================================================
 */
 
 #pragma once
 
 #include <JuceHeader.h>
+#include "SidechainDecimator.h"
+#include <array>
 #include <cmath>
 
+namespace CL1BTables
+{
+    // Builds a lookup table at compile time from its leading values, filling the
+    // remaining entries with a constant (the original tables end in long flat runs)
+    template <size_t N, size_t M>
+    constexpr std::array<float, N> padded (const float (&values)[M], float fill)
+    {
+        static_assert (M <= N, "More values than table entries");
+
+        std::array<float, N> table {};
+        for (size_t i = 0; i < N; ++i)
+            table[i] = (i < M) ? values[i] : fill;
+        return table;
+    }
+}
+
 class CL1BCompressor
 {
 public:
     CL1BCompressor()
     {
         currentSampleRate = 44100.0;
-        initTables();
         reset();
     }
 
@@ -42,11 +62,16 @@ public:
         level_state = 0.0f;
         post_eq_s1 = 0.0f;
         post_eq_s2 = 0.0f;
+        decimator.reset (getOutputGain());
     }
 
     void setSampleRate(double sampleRate)
     {
         currentSampleRate = sampleRate;
+        decimator.setSampleRate (sampleRate);
+
+        // Detector filters run at the (decimated) detector rate
+        const double detectorRate = decimator.getDetectorSampleRate (sampleRate);
 
         // Time constants from original (lines 170-176)
         float lpf1_attack_sec = 1.324200f * 0.001f;
@@ -56,16 +81,14 @@ public:
         float release_sec = 5.898f;
 
         // Calculate filter coefficients (lines 178-185)
-        lpf1_attack = std::exp(-1.0f / (float)(sampleRate * lpf1_attack_sec));
-        lpf1_release = std::exp(-1.0f / (float)(sampleRate * lpf1_release_sec));
-        lpf2_attack = std::exp(-1.0f / (float)(sampleRate * lpf2_attack_sec));
-        lpf2_release = std::exp(-1.0f / (float)(sampleRate * lpf2_release_sec));
+        lpf1_attack = std::exp(-1.0f / (float)(detectorRate * lpf1_attack_sec));
+        lpf1_release = std::exp(-1.0f / (float)(detectorRate * lpf1_release_sec));
+        lpf2_attack = std::exp(-1.0f / (float)(detectorRate * lpf2_attack_sec));
+        lpf2_release = std::exp(-1.0f / (float)(detectorRate * lpf2_release_sec));
 
-        release_k = std::exp(-1.0f / (float)(sampleRate * release_sec));
+        release_k = std::exp(-1.0f / (float)(detectorRate * release_sec));
 
         post_eq_k = 1.0f - std::exp(-2.0f * juce::MathConstants<float>::pi * (20000.0f / (float)sampleRate));
-
-        initTables();
     }
 
     void setParameters(float thresholdDB)
@@ -79,8 +102,8 @@ public:
         float ratio_normalized = (ratio - 2.0f) / 8.0f;
 
         // Calculate T3 and T10 from ratio (lines 201-202)
-        T3 = interpolate_exp(ratio_normalized, table3_exp, 25, false);
-        T10 = interpolate_exp(ratio_normalized, table10_exp, 25, false);
+        T3 = interpolate_exp(ratio_normalized, table3_exp.data(), 25, false);
+        T10 = interpolate_exp(ratio_normalized, table10_exp.data(), 25, false);
 
         // Calculate T4 from T3 (line 206)
         T4 = interpolate_lin(T3, table4_lin, 24);
@@ -97,14 +120,113 @@ public:
 
     float process(float input)
     {
+        if (decimator.isDecimating())
+            return processPostEQ (input * updateLinkedGain (input));
+
         // Process mono (using x1/y1 path from stereo algorithm)
 
         // Feedback signal path (lines 222-224)
         float inv_gr = lpf1_state * 0.2998201f + lpf2_state * 0.079904087f;
         float gain_reduction = 0.0029900903f / clamp(inv_gr + 0.0029900903f);
 
-        // Feedback sidechain path (lines 228-239)
-        float T5 = interpolate_exp(inv_gr, table5_exp, 25, false);
+        // Detector path (lines 228-285)
+        updateDetector (input, getSidechainMult (inv_gr), 1);
+
+        // Output (line 286)
+        float y1 = input * T10 * T11 * gain_reduction * 33.768673f;
+
+        // Post-EQ high shelf at 20kHz (line 290)
+        post_eq_s1 += (y1 - post_eq_s1) * post_eq_k;
+
+        return post_eq_s1;
+    }
+
+    /**
+        Advances the feedback detector over a block without producing audio
+        (control rate, used while the section is bypassed). The feedback path
+        is evaluated once and the envelope filters are stepped numSamples at once.
+        @param level peak input level of the block
+        @param numSamples block length
+    */
+    void advanceDetector (float level, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        float inv_gr = lpf1_state * 0.2998201f + lpf2_state * 0.079904087f;
+        updateDetector (level, getSidechainMult (inv_gr), juce::jmax (1, numSamples / decimator.getFactor()));
+
+        decimator.reset (getOutputGain());
+    }
+
+    /**
+        Stereo link, step 1: runs the shared detector for one sample.
+        @param level linked detector input (e.g. max (|L|, |R|))
+        @return the gain to pass to applyLinkedGain() for each channel
+    */
+    float updateLinkedGain (float level)
+    {
+        if (decimator.isDecimating())
+        {
+            // Peak-preserving decimation: the detector table rectifies, so an
+            // average of the signed sidechain would hide transients
+            if (decimator.push (level))
+            {
+                float inv_gr = lpf1_state * 0.2998201f + lpf2_state * 0.079904087f;
+                updateDetector (decimator.getPeak(), getSidechainMult (inv_gr), 1);
+                decimator.setTargetGain (getOutputGain());
+            }
+
+            return decimator.getNextGain();
+        }
+
+        float inv_gr = lpf1_state * 0.2998201f + lpf2_state * 0.079904087f;
+        float gain_reduction = 0.0029900903f / clamp(inv_gr + 0.0029900903f);
+
+        updateDetector (level, getSidechainMult (inv_gr), 1);
+
+        return T10 * T11 * gain_reduction * 33.768673f;
+    }
+
+    /**
+        Stereo link, step 2: post-EQ of one channel after the shared gain was applied.
+        Each channel keeps its own post-EQ state.
+    */
+    float processPostEQ (float y1)
+    {
+        post_eq_s1 += (y1 - post_eq_s1) * post_eq_k;
+        return post_eq_s1;
+    }
+
+    /** Copies the detector state (keeps a linked partner in sync for unlinking). */
+    void copyDetectorStateFrom (const CL1BCompressor& other)
+    {
+        lpf1_state = other.lpf1_state;
+        lpf2_state = other.lpf2_state;
+        level_state = other.level_state;
+        decimator = other.decimator;
+    }
+
+    float getGainReductionDB() const
+    {
+        float inv_gr = lpf1_state * 0.2998201f + lpf2_state * 0.079904087f;
+        float gain_reduction = 0.0029900903f / clamp(inv_gr + 0.0029900903f);
+        return juce::Decibels::gainToDecibels(gain_reduction);
+    }
+
+private:
+    /** Output gain for the current detector state (line 286 without the input). */
+    float getOutputGain() const
+    {
+        float inv_gr = lpf1_state * 0.2998201f + lpf2_state * 0.079904087f;
+        float gain_reduction = 0.0029900903f / clamp(inv_gr + 0.0029900903f);
+        return T10 * T11 * gain_reduction * 33.768673f;
+    }
+
+    /** Feedback sidechain path (lines 228-239) */
+    float getSidechainMult (float inv_gr) const
+    {
+        float T5 = interpolate_exp(inv_gr, table5_exp.data(), 25, false);
         float T6 = interpolate_lin(T5, table6_lin, 24);
 
         float A1 = 0.01193628f;
@@ -115,8 +237,12 @@ public:
         float m1 = (A1 * T6 + B1 * (1.0f - T6));
         float m2 = (A2 * T6 + B2 * (1.0f - T6));
 
-        float mult = m1 * (1.0f - T4) + m2 * T4;
+        return m1 * (1.0f - T4) + m2 * T4;
+    }
 
+    /** Detector, attack/release and envelope filters (numSamples steps at a constant input). */
+    void updateDetector (float input, float mult, int numSamples)
+    {
         float T2_on = 0.08098298f;
 
         // Detector path (lines 244-250)
@@ -160,33 +286,21 @@ public:
         }
 
         // Table 13 lookup (line 273)
-        float T13 = interpolate_lin(combined_level, table13_lin, 252);
+        float T13 = interpolate_lin(combined_level, table13_lin.data(), 252);
 
         // LPF1 (lines 276-278)
         float lpf1_k = (T13 > lpf1_state) ? lpf1_attack : lpf1_release;
+        if (numSamples > 1)
+            lpf1_k = std::pow(lpf1_k, (float)numSamples);
         lpf1_state = T13 + (lpf1_state - T13) * lpf1_k;
 
         // LPF2 (lines 280-283)
         float lpf2_k = (T13 > lpf2_state) ? lpf2_attack : lpf2_release;
+        if (numSamples > 1)
+            lpf2_k = std::pow(lpf2_k, (float)numSamples);
         lpf2_state = T13 + (lpf2_state - T13) * lpf2_k;
-
-        // Output (line 286)
-        float y1 = input * T10 * T11 * gain_reduction * 33.768673f;
-
-        // Post-EQ high shelf at 20kHz (line 290)
-        post_eq_s1 += (y1 - post_eq_s1) * post_eq_k;
-
-        return post_eq_s1;
     }
 
-    float getGainReductionDB() const
-    {
-        float inv_gr = lpf1_state * 0.2998201f + lpf2_state * 0.079904087f;
-        float gain_reduction = 0.0029900903f / clamp(inv_gr + 0.0029900903f);
-        return juce::Decibels::gainToDecibels(gain_reduction);
-    }
-
-private:
     // Constants (lines 164-166)
     enum AttackReleaseMode
     {
@@ -196,15 +310,96 @@ private:
     };
 
     // Lookup tables (lines 299-650)
-    float table3_exp[25];
-    float table4_lin[24];
-    float table5_exp[25];
-    float table6_lin[24];
-    float table8_lin[46];
-    float table9_lin[24];
-    float table10_exp[25];
-    float table12_exp_neg[48];
-    float table13_lin[252];
+    // Compile-time constant data shared by every instance (none of the tables depend
+    // on sample rate or parameters), so construction costs nothing and all instances
+    // in a session hit the same cache lines.
+    // T3 (lines 302-316)
+    static constexpr auto table3_exp = CL1BTables::padded<25> ({
+            0.999999f, 0.99f, 0.5626293f, 0.2993541f, 0.1536661f, 0.07558671f,
+            0.036547f, 0.01702715f
+        }, 0.01f);  // [8..24] = 0.01f
+
+    // T4 (lines 319-343)
+    static constexpr float table4_lin[24] = {
+        0.0f, 0.03416149f, 0.07852706f, 0.1228926f, 0.1672582f, 0.2116238f,
+        0.2559893f, 0.3003549f, 0.3447205f, 0.3890861f, 0.4334517f, 0.4778172f,
+        0.5221828f, 0.5665483f, 0.6109139f, 0.6552795f, 0.6996451f, 0.7440106f,
+        0.7883762f, 0.8327418f, 0.8771074f, 0.921473f, 0.9658385f, 0.999999f
+    };
+
+    // T5 (lines 346-371)
+    static constexpr auto table5_exp = CL1BTables::padded<25> ({
+            0.01f, 1.0f, 0.9947661f, 0.9844928f, 0.9651101f, 0.9302186f,
+            0.8630559f, 0.755419f, 0.6082814f, 0.4397123f, 0.2796561f, 0.162245f,
+            0.08780019f, 0.04508f, 0.02209106f, 0.01019185f, 0.004130001f, 0.001069335f
+        }, 0.00001000000f);  // [18..24] = 0.00001000000f
+
+    // T6 (lines 374-398)
+    static constexpr float table6_lin[24] = {
+        0.0f, 0.0434687f, 0.08694739f, 0.1304261f, 0.1739048f, 0.2173835f,
+        0.2608622f, 0.3043409f, 0.3478196f, 0.3912983f, 0.434777f, 0.4782557f,
+        0.5217344f, 0.565213f, 0.6086918f, 0.6521704f, 0.6956491f, 0.7391278f,
+        0.7826065f, 0.8260852f, 0.8695639f, 0.9130426f, 0.9565213f, 0.999999f
+    };
+
+    // T8 (lines 403-445)
+    static constexpr float table8_lin[46] = {
+        0.002257127f, 0.002257127f, 0.002257127f, 0.002257127f, 0.002257127f, 0.002257127f,
+        0.002257127f, 0.002257127f, 0.002257127f, 0.002257127f, 0.002257127f, 0.000807641f,
+        0.0002590034f, 0.0001466583f, 0.000105361f, 0.00008688696f, 0.00007712693f, 0.00007082194f,
+        0.00006535164f, 0.00005942077f, 0.00005248035f, 0.00004474115f, 0.00003699339f, 0.00002985739f,
+        0.00002377450f, 0.00001915936f, 0.00001565825f, 0.00001302099f, 0.00001102717f, 0.000009554097f,
+        0.000008418394f, 0.000007519858f, 0.000006788958f, 0.000006188009f, 0.000005677829f, 0.000005232528f,
+        0.000004838532f, 0.000004491788f, 0.000004193505f, 0.000003938723f, 0.000003725471f, 0.000003552736f,
+        0.000003421820f, 0.000003326748f, 0.000003267550f, 0.000003245660f
+    };
+
+    // T9 (lines 448-472)
+    static constexpr float table9_lin[24] = {
+        0.00004848326f, 0.00004848326f, 0.00004848326f, 0.00004188835f, 0.00002785662f, 0.00001560057f,
+        0.00001201397f, 0.000008427365f, 0.000005328864f, 0.000004453937f, 0.000003579009f, 0.000002704082f,
+        0.000002101815f, 0.000001772209f, 0.000001442603f, 0.000001112997f, 8.481028e-7f, 6.281776e-7f,
+        4.082524e-7f, 2.060375e-7f, 1.126142e-7f, 1.919095e-8f, 3.280834e-10f, -4.332800e-9f
+    };
+
+    // T10 (lines 475-489)
+    static constexpr auto table10_exp = CL1BTables::padded<25> ({
+            0.8766871f, 0.8766871f, 0.9343757f, 0.966794f, 0.9838194f, 0.9926132f,
+            0.9970101f, 0.9992085f
+        }, 1.0f);  // [8..24] = 1.0f
+
+    // T12 (lines 494-542)
+    static constexpr float table12_exp_neg[48] = {
+        0.000002987261f, 0.000005974523f, 0.00001194905f, 0.00002389809f, 0.00004779618f, 0.00009559237f,
+        0.0001911847f, 0.0003823695f, 0.0007647389f, 0.001529478f, 0.003058956f, 0.006117912f,
+        0.01223582f, 0.02447165f, 0.04894329f, 0.09788658f, 0.1957732f, 0.3915463f,
+        0.7830927f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+        1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.7810927f,
+        0.3895463f, 0.1937732f, 0.09588659f, 0.04694329f, 0.02247165f, 0.01023582f,
+        0.004117912f, 0.001058956f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f
+    };
+
+    // T13 (lines 545-650)
+    static constexpr auto table13_lin = CL1BTables::padded<252> ({
+            0.0f, 0.002895139f, 0.01001967f, 0.01859283f, 0.0278201f, 0.03739988f,
+            0.04719125f, 0.05711957f, 0.06714159f, 0.07723056f, 0.087369f, 0.09754504f,
+            0.1077503f, 0.1179788f, 0.1282261f, 0.1384886f, 0.1487638f, 0.1590496f,
+            0.1693444f, 0.1796468f, 0.1899559f, 0.2002707f, 0.2105905f, 0.2209146f,
+            0.2312426f, 0.2415741f, 0.2519086f, 0.2622458f, 0.2725855f, 0.2829274f,
+            0.2932713f, 0.303617f, 0.3139643f, 0.3243132f, 0.3346635f, 0.345015f,
+            0.3553677f, 0.3657215f, 0.3760763f, 0.3864319f, 0.3967885f, 0.4071458f,
+            0.4175039f, 0.4278626f, 0.4382221f, 0.4485821f, 0.4589426f, 0.4693037f,
+            0.4796653f, 0.4900274f, 0.5003899f, 0.5107529f, 0.5211161f, 0.5314798f,
+            0.5418439f, 0.5522082f, 0.562573f, 0.5729379f, 0.5833032f, 0.5936688f,
+            0.6040345f, 0.6144006f, 0.6247668f, 0.6351333f, 0.6455f, 0.6558669f,
+            0.666234f, 0.6766013f, 0.6869688f, 0.6973364f, 0.7077042f, 0.7180721f,
+            0.7284402f, 0.7388085f, 0.7491769f, 0.7595453f, 0.769914f, 0.7802827f,
+            0.7906516f, 0.8010206f, 0.8113897f, 0.8217589f, 0.8321282f, 0.8424976f,
+            0.8528671f, 0.8632367f, 0.8736063f, 0.883976f, 0.8943459f, 0.9047158f,
+            0.9150858f, 0.9254559f, 0.935826f, 0.9461962f, 0.9565665f, 0.9669368f,
+            0.9773072f, 0.9876777f, 0.9980482f
+        }, 1.0f);  // [99..251] = 1.0f
 
     // State variables
     float lpf1_state, lpf2_state;
@@ -217,11 +412,12 @@ private:
     float release_k, post_eq_k;
 
     // Parameters
-    float T3, T4, T7, T10, T11;
+    float T3 = 0.0f, T4 = 0.0f, T7 = 1.0f, T10 = 1.0f, T11 = 1.0f;  // Defined before the first setParameters() (reset() reads them)
     float T8, T9;  // For manual attack/release (not used in Fixed mode)
     int attack_release_mode;
 
     double currentSampleRate;
+    SidechainDecimator decimator;
 
     // Helper functions
     static float DB_TO_K(float x)
@@ -265,7 +461,7 @@ private:
     }
 
     // Linear interpolation (lines 92-114)
-    float interpolate_lin(float x, float* table_lin, int table_size)
+    static float interpolate_lin(float x, const float* table_lin, int table_size)
     {
         x = clamp(x);
 
@@ -288,9 +484,9 @@ private:
     }
 
     // Exponential interpolation (lines 116-158)
-    float interpolate_exp(float x, float* table_exp, int table_size, bool is_neg)
+    static float interpolate_exp(float x, const float* table_exp, int table_size, bool is_neg)
     {
-        float* table_ptr = table_exp;
+        const float* table_ptr = table_exp;
 
         if (is_neg)
         {
@@ -344,334 +540,5 @@ private:
         }
     }
 
-    // Initialize all lookup tables (lines 299-650)
-    void initTables()
-    {
-        // T3 (lines 302-316)
-        table3_exp[0] = 0.999999f;
-        table3_exp[1] = 0.99f;
-        table3_exp[2] = 0.5626293f;
-        table3_exp[3] = 0.2993541f;
-        table3_exp[4] = 0.1536661f;
-        table3_exp[5] = 0.07558671f;
-        table3_exp[6] = 0.036547f;
-        table3_exp[7] = 0.01702715f;
-
-        for (int i = 8; i < 25; ++i)
-            table3_exp[i] = 0.01f;
-
-        // T4 (lines 319-343)
-        table4_lin[0] = 0.0f;
-        table4_lin[1] = 0.03416149f;
-        table4_lin[2] = 0.07852706f;
-        table4_lin[3] = 0.1228926f;
-        table4_lin[4] = 0.1672582f;
-        table4_lin[5] = 0.2116238f;
-        table4_lin[6] = 0.2559893f;
-        table4_lin[7] = 0.3003549f;
-        table4_lin[8] = 0.3447205f;
-        table4_lin[9] = 0.3890861f;
-        table4_lin[10] = 0.4334517f;
-        table4_lin[11] = 0.4778172f;
-        table4_lin[12] = 0.5221828f;
-        table4_lin[13] = 0.5665483f;
-        table4_lin[14] = 0.6109139f;
-        table4_lin[15] = 0.6552795f;
-        table4_lin[16] = 0.6996451f;
-        table4_lin[17] = 0.7440106f;
-        table4_lin[18] = 0.7883762f;
-        table4_lin[19] = 0.8327418f;
-        table4_lin[20] = 0.8771074f;
-        table4_lin[21] = 0.921473f;
-        table4_lin[22] = 0.9658385f;
-        table4_lin[23] = 0.999999f;
-
-        // T5 (lines 346-371)
-        table5_exp[0] = 0.01f;
-        table5_exp[1] = 1.0f;
-        table5_exp[2] = 0.9947661f;
-        table5_exp[3] = 0.9844928f;
-        table5_exp[4] = 0.9651101f;
-        table5_exp[5] = 0.9302186f;
-        table5_exp[6] = 0.8630559f;
-        table5_exp[7] = 0.755419f;
-        table5_exp[8] = 0.6082814f;
-        table5_exp[9] = 0.4397123f;
-        table5_exp[10] = 0.2796561f;
-        table5_exp[11] = 0.162245f;
-        table5_exp[12] = 0.08780019f;
-        table5_exp[13] = 0.04508f;
-        table5_exp[14] = 0.02209106f;
-        table5_exp[15] = 0.01019185f;
-        table5_exp[16] = 0.004130001f;
-        table5_exp[17] = 0.001069335f;
-        table5_exp[18] = 0.00001000000f;
-        table5_exp[19] = 0.00001000000f;
-        table5_exp[20] = 0.00001000000f;
-        table5_exp[21] = 0.00001000000f;
-        table5_exp[22] = 0.00001000000f;
-        table5_exp[23] = 0.00001000000f;
-        table5_exp[24] = 0.00001000000f;
-
-        // T6 (lines 374-398)
-        table6_lin[0] = 0.0f;
-        table6_lin[1] = 0.0434687f;
-        table6_lin[2] = 0.08694739f;
-        table6_lin[3] = 0.1304261f;
-        table6_lin[4] = 0.1739048f;
-        table6_lin[5] = 0.2173835f;
-        table6_lin[6] = 0.2608622f;
-        table6_lin[7] = 0.3043409f;
-        table6_lin[8] = 0.3478196f;
-        table6_lin[9] = 0.3912983f;
-        table6_lin[10] = 0.434777f;
-        table6_lin[11] = 0.4782557f;
-        table6_lin[12] = 0.5217344f;
-        table6_lin[13] = 0.565213f;
-        table6_lin[14] = 0.6086918f;
-        table6_lin[15] = 0.6521704f;
-        table6_lin[16] = 0.6956491f;
-        table6_lin[17] = 0.7391278f;
-        table6_lin[18] = 0.7826065f;
-        table6_lin[19] = 0.8260852f;
-        table6_lin[20] = 0.8695639f;
-        table6_lin[21] = 0.9130426f;
-        table6_lin[22] = 0.9565213f;
-        table6_lin[23] = 0.999999f;
-
-        // T8 (lines 403-445)
-        for (int i = 0; i < 11; ++i)
-            table8_lin[i] = 0.002257127f;
-
-        table8_lin[11] = 0.000807641f;
-        table8_lin[12] = 0.0002590034f;
-        table8_lin[13] = 0.0001466583f;
-        table8_lin[14] = 0.000105361f;
-        table8_lin[15] = 0.00008688696f;
-        table8_lin[16] = 0.00007712693f;
-        table8_lin[17] = 0.00007082194f;
-        table8_lin[18] = 0.00006535164f;
-        table8_lin[19] = 0.00005942077f;
-        table8_lin[20] = 0.00005248035f;
-        table8_lin[21] = 0.00004474115f;
-        table8_lin[22] = 0.00003699339f;
-        table8_lin[23] = 0.00002985739f;
-        table8_lin[24] = 0.00002377450f;
-        table8_lin[25] = 0.00001915936f;
-        table8_lin[26] = 0.00001565825f;
-        table8_lin[27] = 0.00001302099f;
-        table8_lin[28] = 0.00001102717f;
-        table8_lin[29] = 0.000009554097f;
-        table8_lin[30] = 0.000008418394f;
-        table8_lin[31] = 0.000007519858f;
-        table8_lin[32] = 0.000006788958f;
-        table8_lin[33] = 0.000006188009f;
-        table8_lin[34] = 0.000005677829f;
-        table8_lin[35] = 0.000005232528f;
-        table8_lin[36] = 0.000004838532f;
-        table8_lin[37] = 0.000004491788f;
-        table8_lin[38] = 0.000004193505f;
-        table8_lin[39] = 0.000003938723f;
-        table8_lin[40] = 0.000003725471f;
-        table8_lin[41] = 0.000003552736f;
-        table8_lin[42] = 0.000003421820f;
-        table8_lin[43] = 0.000003326748f;
-        table8_lin[44] = 0.000003267550f;
-        table8_lin[45] = 0.000003245660f;
-
-        // T9 (lines 448-472)
-        table9_lin[0] = 0.00004848326f;
-        table9_lin[1] = 0.00004848326f;
-        table9_lin[2] = 0.00004848326f;
-        table9_lin[3] = 0.00004188835f;
-        table9_lin[4] = 0.00002785662f;
-        table9_lin[5] = 0.00001560057f;
-        table9_lin[6] = 0.00001201397f;
-        table9_lin[7] = 0.000008427365f;
-        table9_lin[8] = 0.000005328864f;
-        table9_lin[9] = 0.000004453937f;
-        table9_lin[10] = 0.000003579009f;
-        table9_lin[11] = 0.000002704082f;
-        table9_lin[12] = 0.000002101815f;
-        table9_lin[13] = 0.000001772209f;
-        table9_lin[14] = 0.000001442603f;
-        table9_lin[15] = 0.000001112997f;
-        table9_lin[16] = 8.481028e-7f;
-        table9_lin[17] = 6.281776e-7f;
-        table9_lin[18] = 4.082524e-7f;
-        table9_lin[19] = 2.060375e-7f;
-        table9_lin[20] = 1.126142e-7f;
-        table9_lin[21] = 1.919095e-8f;
-        table9_lin[22] = 3.280834e-10f;
-        table9_lin[23] = -4.332800e-9f;
-
-        // T10 (lines 475-489)
-        table10_exp[0] = 0.8766871f;
-        table10_exp[1] = 0.8766871f;
-        table10_exp[2] = 0.9343757f;
-        table10_exp[3] = 0.966794f;
-        table10_exp[4] = 0.9838194f;
-        table10_exp[5] = 0.9926132f;
-        table10_exp[6] = 0.9970101f;
-        table10_exp[7] = 0.9992085f;
-
-        for (int i = 8; i < 25; ++i)
-            table10_exp[i] = 1.0f;
-
-        // T12 (lines 494-542)
-        table12_exp_neg[0] = 0.000002987261f;
-        table12_exp_neg[1] = 0.000005974523f;
-        table12_exp_neg[2] = 0.00001194905f;
-        table12_exp_neg[3] = 0.00002389809f;
-        table12_exp_neg[4] = 0.00004779618f;
-        table12_exp_neg[5] = 0.00009559237f;
-        table12_exp_neg[6] = 0.0001911847f;
-        table12_exp_neg[7] = 0.0003823695f;
-        table12_exp_neg[8] = 0.0007647389f;
-        table12_exp_neg[9] = 0.001529478f;
-        table12_exp_neg[10] = 0.003058956f;
-        table12_exp_neg[11] = 0.006117912f;
-        table12_exp_neg[12] = 0.01223582f;
-        table12_exp_neg[13] = 0.02447165f;
-        table12_exp_neg[14] = 0.04894329f;
-        table12_exp_neg[15] = 0.09788658f;
-        table12_exp_neg[16] = 0.1957732f;
-        table12_exp_neg[17] = 0.3915463f;
-        table12_exp_neg[18] = 0.7830927f;
-        table12_exp_neg[19] = 1.0f;
-        table12_exp_neg[20] = 1.0f;
-        table12_exp_neg[21] = 1.0f;
-        table12_exp_neg[22] = 1.0f;
-        table12_exp_neg[23] = 1.0f;
-        table12_exp_neg[24] = 1.0f;
-        table12_exp_neg[25] = 1.0f;
-        table12_exp_neg[26] = 1.0f;
-        table12_exp_neg[27] = 1.0f;
-        table12_exp_neg[28] = 1.0f;
-        table12_exp_neg[29] = 0.7810927f;
-        table12_exp_neg[30] = 0.3895463f;
-        table12_exp_neg[31] = 0.1937732f;
-        table12_exp_neg[32] = 0.09588659f;
-        table12_exp_neg[33] = 0.04694329f;
-        table12_exp_neg[34] = 0.02247165f;
-        table12_exp_neg[35] = 0.01023582f;
-        table12_exp_neg[36] = 0.004117912f;
-        table12_exp_neg[37] = 0.001058956f;
-        table12_exp_neg[38] = 0.0f;
-        table12_exp_neg[39] = 0.0f;
-        table12_exp_neg[40] = 0.0f;
-        table12_exp_neg[41] = 0.0f;
-        table12_exp_neg[42] = 0.0f;
-        table12_exp_neg[43] = 0.0f;
-        table12_exp_neg[44] = 0.0f;
-        table12_exp_neg[45] = 0.0f;
-        table12_exp_neg[46] = 0.0f;
-        table12_exp_neg[47] = 0.0f;
-
-        // T13 (lines 545-650)
-        table13_lin[0] = 0.0f;
-        table13_lin[1] = 0.002895139f;
-        table13_lin[2] = 0.01001967f;
-        table13_lin[3] = 0.01859283f;
-        table13_lin[4] = 0.0278201f;
-        table13_lin[5] = 0.03739988f;
-        table13_lin[6] = 0.04719125f;
-        table13_lin[7] = 0.05711957f;
-        table13_lin[8] = 0.06714159f;
-        table13_lin[9] = 0.07723056f;
-        table13_lin[10] = 0.087369f;
-        table13_lin[11] = 0.09754504f;
-        table13_lin[12] = 0.1077503f;
-        table13_lin[13] = 0.1179788f;
-        table13_lin[14] = 0.1282261f;
-        table13_lin[15] = 0.1384886f;
-        table13_lin[16] = 0.1487638f;
-        table13_lin[17] = 0.1590496f;
-        table13_lin[18] = 0.1693444f;
-        table13_lin[19] = 0.1796468f;
-        table13_lin[20] = 0.1899559f;
-        table13_lin[21] = 0.2002707f;
-        table13_lin[22] = 0.2105905f;
-        table13_lin[23] = 0.2209146f;
-        table13_lin[24] = 0.2312426f;
-        table13_lin[25] = 0.2415741f;
-        table13_lin[26] = 0.2519086f;
-        table13_lin[27] = 0.2622458f;
-        table13_lin[28] = 0.2725855f;
-        table13_lin[29] = 0.2829274f;
-        table13_lin[30] = 0.2932713f;
-        table13_lin[31] = 0.303617f;
-        table13_lin[32] = 0.3139643f;
-        table13_lin[33] = 0.3243132f;
-        table13_lin[34] = 0.3346635f;
-        table13_lin[35] = 0.345015f;
-        table13_lin[36] = 0.3553677f;
-        table13_lin[37] = 0.3657215f;
-        table13_lin[38] = 0.3760763f;
-        table13_lin[39] = 0.3864319f;
-        table13_lin[40] = 0.3967885f;
-        table13_lin[41] = 0.4071458f;
-        table13_lin[42] = 0.4175039f;
-        table13_lin[43] = 0.4278626f;
-        table13_lin[44] = 0.4382221f;
-        table13_lin[45] = 0.4485821f;
-        table13_lin[46] = 0.4589426f;
-        table13_lin[47] = 0.4693037f;
-        table13_lin[48] = 0.4796653f;
-        table13_lin[49] = 0.4900274f;
-        table13_lin[50] = 0.5003899f;
-        table13_lin[51] = 0.5107529f;
-        table13_lin[52] = 0.5211161f;
-        table13_lin[53] = 0.5314798f;
-        table13_lin[54] = 0.5418439f;
-        table13_lin[55] = 0.5522082f;
-        table13_lin[56] = 0.562573f;
-        table13_lin[57] = 0.5729379f;
-        table13_lin[58] = 0.5833032f;
-        table13_lin[59] = 0.5936688f;
-        table13_lin[60] = 0.6040345f;
-        table13_lin[61] = 0.6144006f;
-        table13_lin[62] = 0.6247668f;
-        table13_lin[63] = 0.6351333f;
-        table13_lin[64] = 0.6455f;
-        table13_lin[65] = 0.6558669f;
-        table13_lin[66] = 0.666234f;
-        table13_lin[67] = 0.6766013f;
-        table13_lin[68] = 0.6869688f;
-        table13_lin[69] = 0.6973364f;
-        table13_lin[70] = 0.7077042f;
-        table13_lin[71] = 0.7180721f;
-        table13_lin[72] = 0.7284402f;
-        table13_lin[73] = 0.7388085f;
-        table13_lin[74] = 0.7491769f;
-        table13_lin[75] = 0.7595453f;
-        table13_lin[76] = 0.769914f;
-        table13_lin[77] = 0.7802827f;
-        table13_lin[78] = 0.7906516f;
-        table13_lin[79] = 0.8010206f;
-        table13_lin[80] = 0.8113897f;
-        table13_lin[81] = 0.8217589f;
-        table13_lin[82] = 0.8321282f;
-        table13_lin[83] = 0.8424976f;
-        table13_lin[84] = 0.8528671f;
-        table13_lin[85] = 0.8632367f;
-        table13_lin[86] = 0.8736063f;
-        table13_lin[87] = 0.883976f;
-        table13_lin[88] = 0.8943459f;
-        table13_lin[89] = 0.9047158f;
-        table13_lin[90] = 0.9150858f;
-        table13_lin[91] = 0.9254559f;
-        table13_lin[92] = 0.935826f;
-        table13_lin[93] = 0.9461962f;
-        table13_lin[94] = 0.9565665f;
-        table13_lin[95] = 0.9669368f;
-        table13_lin[96] = 0.9773072f;
-        table13_lin[97] = 0.9876777f;
-        table13_lin[98] = 0.9980482f;
-
-        for (int i = 99; i < 252; ++i)
-            table13_lin[i] = 1.0f;
-    }
-
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CL1BCompressor)
 };
@@ -22,17 +22,22 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "DenormalPolicy.h"
 #include <cmath>
 
 //==============================================================================
 /**
     ClipSoftly algorithm from AirWindows.
     Soft clipper with sin waveshaping and adaptive smoothing.
+
+    The PRNG only feeds the denormal guard, so it doesn't run at all under
+    DenormalPolicy::FlushToZero.
 */
-class ClipSoftly
+template <DenormalPolicy Policy = defaultDenormalPolicy>
+class ClipSoftlyProcessor
 {
 public:
-    ClipSoftly()
+    ClipSoftlyProcessor()
     {
         reset();
     }
@@ -66,13 +71,13 @@ public:
         @param input the input sample
         @return the processed sample
     */
-    float process (float input)
+    template <typename SampleType>
+    SampleType process (SampleType input)
     {
         double inputSample = input;
 
-        // Denormal prevention
-        if (std::fabs (inputSample) < 1.18e-23)
-            inputSample = fpd * 1.18e-17;
+        // Denormal prevention (see DenormalPolicy.h)
+        Denormals::replaceIfTiny<Policy> (inputSample, fpd);
 
         // Calculate adaptive smoothing factor
         double softSpeed = std::fabs (inputSample);
@@ -101,11 +106,14 @@ public:
         lastSample = intermediate[0]; // Run a little buffer to handle this
 
         // PRNG for denormal prevention
-        fpd ^= fpd << 13;
-        fpd ^= fpd >> 17;
-        fpd ^= fpd << 5;
-
-        return static_cast<float> (inputSample);
+        if constexpr (Policy == DenormalPolicy::AirwindowsFaithful)
+        {
+            fpd ^= fpd << 13;
+            fpd ^= fpd >> 17;
+            fpd ^= fpd << 5;
+        }
+
+        return static_cast<SampleType> (inputSample);
     }
 
 private:
@@ -118,5 +126,8 @@ private:
     double intermediate[16];
     uint32_t fpd = 17; // PRNG state for denormal prevention
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ClipSoftly)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ClipSoftlyProcessor)
 };
+
+//==============================================================================
+using ClipSoftly = ClipSoftlyProcessor<>;
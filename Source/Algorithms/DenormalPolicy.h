@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    DenormalPolicy.h
+    How the Airwindows ports keep their recursive state out of denormals
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    The original Airwindows code guards every sample of every stage:
+        if (fabs (inputSample) < 1.18e-23) inputSample = fpd * 1.18e-17;
+    (or zeroes it), and advances an xorshift PRNG per sample just to feed the
+    guard. Inside this plugin the processor already runs each block under
+    juce::ScopedNoDenormals (FTZ/DAZ on x86, FZ on ARM), so the guard is a
+    compare, a branch and often a PRNG step per sample per stage that buys
+    nothing.
+
+    Two policies:
+    - FlushToZero (default): no per-sample guard. The FPU flushes denormals,
+      and the stages hosting the ports add a tiny offset to the port's input
+      that flips sign every block (Denormals::BlockOffset), so its filter and
+      envelope state never decays towards the denormal range even where
+      flushing isn't available. Only the ports see it: silence through Clean
+      algorithms, bypassed sections and the other stages stays exact.
+    - AirwindowsFaithful: the original guards, sample for sample. Output is
+      bit-identical to the faithful ports. Build with
+      ANALOGCHANNEL_FAITHFUL_DENORMALS=1 (CMake option of the same name, or
+      the Projucer project's preprocessor definitions).
+
+    The two differ only on (near) digital silence, where the original guard
+    injects PRNG noise of up to ~-146dBFS and the offset sits at -400dBFS.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#ifndef ANALOGCHANNEL_FAITHFUL_DENORMALS
+ #define ANALOGCHANNEL_FAITHFUL_DENORMALS 0
+#endif
+
+//==============================================================================
+enum class DenormalPolicy
+{
+    FlushToZero,        // Rely on FTZ/DAZ plus the per-block offset
+    AirwindowsFaithful  // Per-sample guards as in the original code
+};
+
+/** Policy the plugin's algorithm aliases (PurestDrive, ToTape8, ...) are built with. */
+constexpr DenormalPolicy defaultDenormalPolicy = ANALOGCHANNEL_FAITHFUL_DENORMALS ? DenormalPolicy::AirwindowsFaithful
+                                                                                  : DenormalPolicy::FlushToZero;
+
+namespace Denormals
+{
+    /**
+        Magnitude of the per-block chain offset (-400dBFS, far above the float
+        denormal range). The sign flips every block, so DC-blocking stages
+        (highpass, dielectric filters) keep seeing it instead of settling on zero.
+    */
+    constexpr float blockOffset = 1.0e-20f;
+
+    /**
+        The offset a stage adds to its Airwindows ports' input: +-blockOffset,
+        flipped by next() once per block; always zero under AirwindowsFaithful.
+    */
+    class BlockOffset
+    {
+    public:
+        float next()
+        {
+            value = -value;
+            return value;
+        }
+
+        void reset() { value = initialValue; }
+
+    private:
+        static constexpr float initialValue = defaultDenormalPolicy == DenormalPolicy::FlushToZero ? blockOffset : 0.0f;
+        float value = initialValue;
+    };
+
+    /** The original zeroing guard (PurestDrive, Tube2, Baxandall2); compiled out under FlushToZero. */
+    template <DenormalPolicy Policy, typename FloatType>
+    inline void zeroIfTiny (FloatType& sample)
+    {
+        if constexpr (Policy == DenormalPolicy::AirwindowsFaithful)
+        {
+            if (std::fabs (sample) < FloatType (1.18e-23))
+                sample = FloatType (0.0);
+        }
+    }
+
+    /** The original noise-injecting guard (ToTape8, Channel8, ClipSoftly, PurestConsole3). */
+    template <DenormalPolicy Policy, typename FloatType>
+    inline void replaceIfTiny (FloatType& sample, uint32_t fpd)
+    {
+        if constexpr (Policy == DenormalPolicy::AirwindowsFaithful)
+        {
+            if (std::fabs (sample) < FloatType (1.18e-23))
+                sample = fpd * FloatType (1.18e-17);
+        }
+    }
+}
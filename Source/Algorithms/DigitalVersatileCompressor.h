@@ -16,12 +16,15 @@
     Clean, transparent compressor for peak control.
     Fixed parameters: Ratio 4:1, Peak detection (RMS=0), No auto-makeup
 
+    Above ~72kHz the detector runs decimated (see SidechainDecimator.h).
+
   ==============================================================================
 */
 
 #pragma once
 
 #include <JuceHeader.h>
+#include "SidechainDecimator.h"
 #include <cmath>
 
 //==============================================================================
@@ -44,11 +47,14 @@ public:
         seekGain = 1.0f;
         t = 0.0f;
         gr_meter = 1.0f;
+        decimator.reset();
     }
 
     void setSampleRate (double sampleRate)
     {
-        currentSampleRate = sampleRate;
+        // Detector, ballistics and meter run at the (decimated) detector rate
+        decimator.setSampleRate (sampleRate);
+        currentSampleRate = decimator.getDetectorSampleRate (sampleRate);
 
         // Peak detection filter coefficients
         b = static_cast<float>(-std::exp (-60.0 / currentSampleRate));
@@ -90,11 +96,97 @@ public:
     */
     float process (float input)
     {
-        // Peak detection with smooth filter
         // Original: rms = max(abs(spl0), abs(spl1)) for stereo
         // Mono: just abs(input)
-        float rms = std::abs (input);
-        rms = std::sqrt ((t = a * rms - b * t));
+        const float gainToApply = updateGain (std::abs (input));
+
+        // Apply compression
+        return input * gainToApply;
+    }
+
+    /**
+        Runs detector, gain computer, ballistics and meter for one sample.
+        Used directly for stereo-linked processing, where the caller supplies
+        the linked detector level and applies the gain to both channels.
+        @param level detector input (absolute value, e.g. max (|L|, |R|))
+        @return the gain to apply (including output volume)
+    */
+    float updateGain (float level)
+    {
+        if (decimator.isDecimating())
+        {
+            // Boxcar low-pass of the rectified sidechain (the detector averages anyway)
+            if (decimator.push (level))
+                decimator.setTargetGain (stepDetector (decimator.getMeanAbsolute()));
+
+            return decimator.getNextGain() * volume;
+        }
+
+        return stepDetector (level) * volume;
+    }
+
+    /** Copies detector and gain state (keeps a linked partner in sync for unlinking). */
+    void copyStateFrom (const DigitalVersatileCompressor& other)
+    {
+        gain = other.gain;
+        seekGain = other.seekGain;
+        t = other.t;
+        gr_meter = other.gr_meter;
+        decimator = other.decimator;
+    }
+
+    /**
+        Advances detector, gain ballistics and meter over a block without
+        producing audio (control rate, used while the section is bypassed).
+        The detector filter is solved in closed form for a constant input level.
+        @param level mean absolute input level of the block
+        @param numSamples block length
+    */
+    void advanceDetector (float level, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        // Number of detector steps (the detector may run decimated)
+        const float n = static_cast<float> (numSamples) / static_cast<float> (decimator.getFactor());
+
+        // t[k+1] = a*x - b*t[k] with a = 1 + b  ->  t[n] = x + (-b)^n * (t[0] - x)
+        t = level + (t - level) * std::pow (-b, n);
+        const float rms = std::sqrt (t);
+
+        seekGain = (rms > thresh)
+                       ? std::exp ((threshDB + (std::log (rms) * c - threshDB) * ratio) / c) / rms
+                       : 1.0f;
+
+        gain = (gain > seekGain)
+                   ? std::max (gain * std::pow (attack, n), seekGain)
+                   : std::min (gain / std::pow (release, n), seekGain);
+
+        if (gain < gr_meter)
+            gr_meter = gain;
+        else
+            gr_meter = std::min (gr_meter * std::pow (gr_meter_decay, n), 1.0f);
+
+        decimator.reset (gain);
+    }
+
+    //==============================================================================
+    /**
+        Get current gain reduction in decibels (for metering).
+        @return gain reduction in dB (negative value, 0 = no reduction)
+    */
+    float getGainReductionDB() const
+    {
+        return (gr_meter > 0.0f) ? std::log (gr_meter) * (20.0f / std::log (10.0f)) : -150.0f;
+    }
+
+private:
+    //==============================================================================
+    /** One detector step: detector, gain computer, ballistics and meter. Returns the gain. */
+    float stepDetector (float level)
+    {
+        // Peak detection with smooth filter
+        float rms = std::sqrt ((t = a * level - b * t));
 
         // Compress mode only (not limit) - no additional max() operation
         // slider8=0 means compress mode, so we skip: rms = max(rms, rmsS)
@@ -111,9 +203,6 @@ public:
                    ? std::max (gain * attack, seekGain)   // Attack (gain going down)
                    : std::min (gain / release, seekGain); // Release (gain going up)
 
-        // Apply compression
-        float output = input * gain * volume;
-
         // Update gain reduction meter
         if (gain < gr_meter)
         {
@@ -126,22 +215,12 @@ public:
                 gr_meter = 1.0f;
         }
 
-        return output;
+        return gain;
     }
 
     //==============================================================================
-    /**
-        Get current gain reduction in decibels (for metering).
-        @return gain reduction in dB (negative value, 0 = no reduction)
-    */
-    float getGainReductionDB() const
-    {
-        return (gr_meter > 0.0f) ? std::log (gr_meter) * (20.0f / std::log (10.0f)) : -150.0f;
-    }
-
-private:
-    //==============================================================================
-    double currentSampleRate = 44100.0;
+    double currentSampleRate = 44100.0;  // Detector rate
+    SidechainDecimator decimator;
 
     // State variables
     float gain = 1.0f;
@@ -67,7 +67,8 @@ public:
         @param input the input sample
         @return the processed sample
     */
-    float process (float input)
+    template <typename SampleType>
+    SampleType process (SampleType input)
     {
         double inputSample = input;
 
@@ -125,7 +126,7 @@ public:
 
         lastSample = intermediate[0]; // Run a little buffer to handle this
 
-        return static_cast<float> (inputSample);
+        return static_cast<SampleType> (inputSample);
     }
 
 private:
@@ -0,0 +1,312 @@
+/*
+  ==============================================================================
+
+    PolyphaseResampler.h
+    Integer-factor polyphase decimator/interpolator pair for the eco mode
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    Eco mode runs the whole channel strip at the native rate the Airwindows
+    ports were designed for (44.1/48kHz) when the session runs at 2x or 4x
+    that rate. Each channel is decimated on the way in and interpolated on the
+    way out with the same linear-phase FIR (Kaiser-windowed sinc), evaluated
+    in polyphase form so only the taps that produce an output are computed.
+
+    Filter: tapsPerPhase * factor taps, cutoff just below the internal Nyquist,
+    Kaiser beta 7 (~70dB stopband). Passband is flat to 20kHz at 88.2kHz and
+    above; the residual alias band stays above 20kHz.
+
+    Latency (round trip, host rate): numTaps - 1 samples, constant for the
+    session (see getLatencySamples()).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../BlockKernels.h"
+#include <cmath>
+#include <vector>
+
+//==============================================================================
+/**
+    One channel of down-process-up resampling by an integer factor.
+
+    Usage per block: downsample() the host block into an internal buffer,
+    process the internal samples, then upsample() them back into the host
+    block. The number of internal samples per block varies by one when the
+    block size isn't a multiple of the factor; an output FIFO primed with
+    (factor - 1) samples keeps the host side sample-exact.
+
+    The host side can be float or double; the internal samples and the filter
+    run in float (eco mode trades precision for CPU anyway).
+
+    prepare() allocates (message thread / prepareToPlay only); the processing
+    calls never allocate.
+*/
+class PolyphaseResampler
+{
+public:
+    static constexpr int tapsPerPhase = 48;
+    static constexpr double kaiserBeta = 7.0;
+
+    PolyphaseResampler() = default;
+
+    //==============================================================================
+    /**
+        Designs the filter and sizes the buffers.
+        @param resamplingFactor integer ratio between host and internal rate (1 = off)
+        @param maxHostBlockSize largest host block passed to downsample()/upsample()
+    */
+    void prepare (int resamplingFactor, int maxHostBlockSize)
+    {
+        factor = juce::jmax (1, resamplingFactor);
+        numTaps = tapsPerPhase * factor;
+
+        designFilter();
+
+        // Histories are stored twice (double-length ring) so every dot product
+        // reads one contiguous run of samples without wrapping
+        inputHistory.assign (static_cast<size_t> (2 * numTaps), 0.0f);
+        internalHistory.assign (static_cast<size_t> (2 * tapsPerPhase), 0.0f);
+
+        fifoSize = maxHostBlockSize + 2 * factor;
+        outputFifo.assign (static_cast<size_t> (fifoSize), 0.0f);
+
+        reset();
+    }
+
+    /** Clears all filter history (the output restarts from silence). */
+    void reset()
+    {
+        std::fill (inputHistory.begin(), inputHistory.end(), 0.0f);
+        std::fill (internalHistory.begin(), internalHistory.end(), 0.0f);
+        std::fill (outputFifo.begin(), outputFifo.end(), 0.0f);
+
+        inputPosition = 0;
+        internalPosition = 0;
+        decimationPhase = 0;
+
+        // Primed so upsample() never underruns when blocks aren't a multiple of the factor
+        fifoReadPosition = 0;
+        fifoCount = factor - 1;
+        fifoWritePosition = fifoCount;
+    }
+
+    int getFactor() const { return factor; }
+
+    /** Round-trip delay in host samples (decimation + interpolation filters + FIFO priming). */
+    int getLatencySamples() const
+    {
+        return factor > 1 ? numTaps - 1 : 0;
+    }
+
+    /** Largest number of internal samples downsample() can produce for the given host block. */
+    static int getMaxInternalBlockSize (int maxHostBlockSize, int resamplingFactor)
+    {
+        return maxHostBlockSize / juce::jmax (1, resamplingFactor) + 1;
+    }
+
+    //==============================================================================
+    /**
+        Low-pass filters and decimates one host block.
+        @return the number of internal samples written to output
+    */
+    template <typename SampleType>
+    int downsample (const SampleType* input, int numSamples, float* output)
+    {
+        int numOutput = 0;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto sample = static_cast<float> (input[i]);
+            inputHistory[static_cast<size_t> (inputPosition)] = sample;
+            inputHistory[static_cast<size_t> (inputPosition + numTaps)] = sample;
+            inputPosition = (inputPosition + 1 == numTaps) ? 0 : inputPosition + 1;
+
+            if (++decimationPhase < factor)
+                continue;
+
+            decimationPhase = 0;
+
+            // Oldest sample first, reversed kernel: plain dot product
+            output[numOutput++] = BlockKernels::dotProduct (reversedKernel.data(), inputHistory.data() + inputPosition, numTaps);
+        }
+
+        return numOutput;
+    }
+
+    /**
+        Interpolates the processed internal samples and writes one host block.
+        Must be called once per downsample() call, with the same numHostSamples.
+    */
+    template <typename SampleType>
+    void upsample (const float* input, int numInternalSamples, SampleType* output, int numHostSamples)
+    {
+        for (int i = 0; i < numInternalSamples; ++i)
+        {
+            internalHistory[static_cast<size_t> (internalPosition)] = input[i];
+            internalHistory[static_cast<size_t> (internalPosition + tapsPerPhase)] = input[i];
+            internalPosition = (internalPosition + 1 == tapsPerPhase) ? 0 : internalPosition + 1;
+
+            const float* history = internalHistory.data() + internalPosition;
+
+            for (int phase = 0; phase < factor; ++phase)
+            {
+                outputFifo[static_cast<size_t> (fifoWritePosition)]
+                    = BlockKernels::dotProduct (phaseKernels[static_cast<size_t> (phase)].data(), history, tapsPerPhase);
+                fifoWritePosition = (fifoWritePosition + 1 == fifoSize) ? 0 : fifoWritePosition + 1;
+            }
+
+            fifoCount += factor;
+        }
+
+        jassert (fifoCount >= numHostSamples);
+
+        for (int i = 0; i < numHostSamples; ++i)
+        {
+            output[i] = static_cast<SampleType> (outputFifo[static_cast<size_t> (fifoReadPosition)]);
+            fifoReadPosition = (fifoReadPosition + 1 == fifoSize) ? 0 : fifoReadPosition + 1;
+        }
+
+        fifoCount -= numHostSamples;
+    }
+
+private:
+    //==============================================================================
+    void designFilter()
+    {
+        // Windowed sinc, cutoff slightly below the internal Nyquist (cycles/sample at host rate)
+        const double cutoff = 0.5 / static_cast<double> (factor) * 0.97;
+        const double centre = 0.5 * static_cast<double> (numTaps - 1);
+        const double windowNorm = besselI0 (kaiserBeta);
+
+        std::vector<double> kernel (static_cast<size_t> (numTaps));
+        double sum = 0.0;
+
+        for (int n = 0; n < numTaps; ++n)
+        {
+            const double x = static_cast<double> (n) - centre;
+            const double sinc = (x == 0.0) ? 2.0 * cutoff
+                                           : std::sin (2.0 * juce::MathConstants<double>::pi * cutoff * x)
+                                                 / (juce::MathConstants<double>::pi * x);
+            const double r = x / centre;
+            const double window = besselI0 (kaiserBeta * std::sqrt (juce::jmax (0.0, 1.0 - r * r))) / windowNorm;
+
+            kernel[static_cast<size_t> (n)] = sinc * window;
+            sum += kernel[static_cast<size_t> (n)];
+        }
+
+        // Decimator: unity DC gain, reversed for the oldest-first history
+        reversedKernel.resize (static_cast<size_t> (numTaps));
+        for (int n = 0; n < numTaps; ++n)
+            reversedKernel[static_cast<size_t> (n)] = static_cast<float> (kernel[static_cast<size_t> (numTaps - 1 - n)] / sum);
+
+        // Interpolator: one sub-kernel per output phase, gain = factor (zero stuffing)
+        phaseKernels.assign (static_cast<size_t> (factor), std::vector<float> (static_cast<size_t> (tapsPerPhase)));
+        for (int phase = 0; phase < factor; ++phase)
+            for (int j = 0; j < tapsPerPhase; ++j)
+            {
+                // Tap j*factor + phase applies to the internal sample j steps back;
+                // stored oldest first to match the history layout
+                const double tap = kernel[static_cast<size_t> (j * factor + phase)] / sum * static_cast<double> (factor);
+                phaseKernels[static_cast<size_t> (phase)][static_cast<size_t> (tapsPerPhase - 1 - j)] = static_cast<float> (tap);
+            }
+    }
+
+    static double besselI0 (double x)
+    {
+        // Power series, converges quickly for the beta range used here
+        double sum = 1.0, term = 1.0;
+        for (int k = 1; k < 32; ++k)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+        }
+        return sum;
+    }
+
+    //==============================================================================
+    int factor = 1;
+    int numTaps = tapsPerPhase;
+
+    std::vector<float> reversedKernel;                 // Decimator taps
+    std::vector<std::vector<float>> phaseKernels;      // Interpolator taps, one set per phase
+
+    std::vector<float> inputHistory;     // Host-rate input, double-length ring
+    int inputPosition = 0;
+    int decimationPhase = 0;
+
+    std::vector<float> internalHistory;  // Internal-rate samples, double-length ring
+    int internalPosition = 0;
+
+    std::vector<float> outputFifo;       // Host-rate output waiting to be read
+    int fifoSize = 0;
+    int fifoReadPosition = 0;
+    int fifoWritePosition = 0;
+    int fifoCount = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PolyphaseResampler)
+};
+
+//==============================================================================
+/**
+    Plain delay for the dry path, so host bypass keeps the latency the eco
+    mode reports. Runs every block (write only while processing) so it always
+    holds the recent input. Stored in double, so float and double hosts both
+    get their input back bit-exact.
+*/
+class LatencyCompensationDelay
+{
+public:
+    LatencyCompensationDelay() = default;
+
+    /** Allocates the delay line (message thread / prepareToPlay only). */
+    void prepare (int delaySamples)
+    {
+        delay = juce::jmax (0, delaySamples);
+        buffer.assign (static_cast<size_t> (juce::jmax (1, delay)), 0.0);
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill (buffer.begin(), buffer.end(), 0.0);
+        position = 0;
+    }
+
+    /**
+        Delays input into output (may be the same buffer). With output == nullptr
+        the input is only recorded.
+    */
+    template <typename SampleType>
+    void process (const SampleType* input, std::remove_const_t<SampleType>* output, int numSamples)
+    {
+        if (delay == 0)
+        {
+            if (output != nullptr && output != input)
+                juce::FloatVectorOperations::copy (output, input, numSamples);
+            return;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const SampleType in = input[i];
+
+            if (output != nullptr)
+                output[i] = static_cast<SampleType> (buffer[static_cast<size_t> (position)]);
+
+            buffer[static_cast<size_t> (position)] = in;
+            position = (position + 1 == delay) ? 0 : position + 1;
+        }
+    }
+
+private:
+    std::vector<double> buffer;
+    int delay = 0;
+    int position = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LatencyCompensationDelay)
+};
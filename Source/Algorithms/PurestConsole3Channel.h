@@ -22,17 +22,20 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "DenormalPolicy.h"
 #include <cmath>
 
 //==============================================================================
 /**
     PurestConsole3Channel algorithm from AirWindows.
     Very subtle console saturation with polynomial waveshaping.
+    Stateless apart from the denormal PRNG (skipped under FlushToZero).
 */
-class PurestConsole3Channel
+template <DenormalPolicy Policy = defaultDenormalPolicy>
+class PurestConsole3ChannelProcessor
 {
 public:
-    PurestConsole3Channel()
+    PurestConsole3ChannelProcessor()
     {
         reset();
     }
@@ -54,13 +57,13 @@ public:
         @param input the input sample
         @return the processed sample
     */
-    float process (float input)
+    template <typename SampleType>
+    SampleType process (SampleType input)
     {
         double inputSample = input;
 
-        // Denormal prevention
-        if (std::fabs (inputSample) < 1.18e-23)
-            inputSample = fpd * 1.18e-17;
+        // Denormal prevention (see DenormalPolicy.h)
+        Denormals::replaceIfTiny<Policy> (inputSample, fpd);
 
         // Polynomial waveshaping (crude sine approximation)
         // Original comment: "Note that because modern processors love math more than extra variables, this is optimized"
@@ -68,11 +71,14 @@ public:
                      - ((std::pow (inputSample, 3) / 8.0) + (std::pow (inputSample, 7) / 4096.0));
 
         // PRNG for denormal prevention (chaotic noise generator)
-        fpd ^= fpd << 13;
-        fpd ^= fpd >> 17;
-        fpd ^= fpd << 5;
-
-        return static_cast<float> (inputSample);
+        if constexpr (Policy == DenormalPolicy::AirwindowsFaithful)
+        {
+            fpd ^= fpd << 13;
+            fpd ^= fpd >> 17;
+            fpd ^= fpd << 5;
+        }
+
+        return static_cast<SampleType> (inputSample);
     }
 
 private:
@@ -80,5 +86,8 @@ private:
     double currentSampleRate = 44100.0;
     uint32_t fpd = 17;  // PRNG state for denormal prevention
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PurestConsole3Channel)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PurestConsole3ChannelProcessor)
 };
+
+//==============================================================================
+using PurestConsole3Channel = PurestConsole3ChannelProcessor<>;
@@ -0,0 +1,133 @@
+/*
+  ==============================================================================
+
+    SidechainDecimator.h
+    Multirate sidechain for the dynamics processors
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    The dynamics detectors (attack times 0.2 - 30ms) don't need more than
+    ~48kHz of time resolution. At higher session rates the sidechain is
+    low-passed and decimated to about 48kHz (integer factor), the detector
+    runs once per group of samples, and the resulting gain is linearly
+    interpolated back to full rate. The audio path itself stays at full rate.
+
+    At 44.1/48kHz the factor is 1 and callers keep their original per-sample
+    path, so the sound there is unchanged.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+
+//==============================================================================
+/**
+    Collects one group of sidechain samples per detector step and ramps the
+    detector's gain across the next group.
+
+    The group is reduced three ways, so each detector can pick the pre-filter
+    that suits it: mean absolute / mean square (boxcar low-pass of the
+    rectified sidechain) for averaging detectors, and the largest-magnitude
+    sample for peak detectors (an average would hide transients).
+
+    Cost per sample: accumulate plus one add for the gain ramp. The gain lags
+    the input by one group (at most 4 samples at 192kHz).
+*/
+class SidechainDecimator
+{
+public:
+    static constexpr double targetSampleRate = 48000.0;
+
+    SidechainDecimator() = default;
+
+    //==============================================================================
+    /** Chooses the decimation factor for the session rate (1 up to ~72kHz). */
+    void setSampleRate (double sampleRate)
+    {
+        factor = juce::jmax (1, juce::roundToInt (sampleRate / targetSampleRate));
+        invFactor = 1.0f / static_cast<float> (factor);
+        clearGroup();
+    }
+
+    /** Sample rate the detector runs at (use it for the detector coefficients). */
+    double getDetectorSampleRate (double sampleRate) const
+    {
+        return sampleRate / static_cast<double> (factor);
+    }
+
+    int getFactor() const { return factor; }
+    bool isDecimating() const { return factor > 1; }
+
+    /** Clears the current group and holds the output gain at the given value. */
+    void reset (float initialGain = 1.0f)
+    {
+        clearGroup();
+        gain = initialGain;
+        gainStep = 0.0f;
+    }
+
+    //==============================================================================
+    /**
+        Adds one sidechain sample.
+        @return true when the group is complete - run the detector on the group
+                levels, then call setTargetGain()
+    */
+    bool push (float input)
+    {
+        const float magnitude = std::abs (input);
+
+        sumAbsolute += magnitude;
+        sumSquares += input * input;
+
+        if (magnitude > std::abs (peak))
+            peak = input;
+
+        return ++count == factor;
+    }
+
+    float getMeanAbsolute() const { return sumAbsolute * invFactor; }
+    float getMeanSquare() const { return sumSquares * invFactor; }
+
+    /** Largest-magnitude sample of the group (keeps its sign). */
+    float getPeak() const { return peak; }
+
+    /** Starts the next group: the output gain ramps to the new target over it. */
+    void setTargetGain (float targetGain)
+    {
+        gainStep = (targetGain - gain) * invFactor;
+        clearGroup();
+    }
+
+    /** Interpolated gain for the current sample. */
+    float getNextGain()
+    {
+        gain += gainStep;
+        return gain;
+    }
+
+private:
+    void clearGroup()
+    {
+        count = 0;
+        sumAbsolute = 0.0f;
+        sumSquares = 0.0f;
+        peak = 0.0f;
+    }
+
+    int factor = 1;
+    float invFactor = 1.0f;
+
+    // Current group
+    int count = 0;
+    float sumAbsolute = 0.0f;
+    float sumSquares = 0.0f;
+    float peak = 0.0f;
+
+    // Gain ramp (exactly factor steps per group, re-anchored every group)
+    float gain = 1.0f;
+    float gainStep = 0.0f;
+};
@@ -33,13 +33,21 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "DenormalPolicy.h"
 
 //==============================================================================
 /**
     ToTape8 tape saturation algorithm from AirWindows.
     Full implementation with fixed parameters except inputGain.
+
+    ToTape8Float runs the audio path in float but keeps the flutter phase and
+    the head bump resonator in double: in float the ~70Hz resonant biquad
+    drifts (residual only 70-90dB down). With that split the residual is
+    ~100-115dB below the signal. The saving is small (~2%), the cost here is
+    in the transcendental calls and the flutter delay line, not the state.
 */
-class ToTape8
+template <typename FloatType, DenormalPolicy Policy = defaultDenormalPolicy>
+class ToTape8Processor
 {
 public:
     enum
@@ -65,7 +73,7 @@ public:
         hdb_total
     };
 
-    ToTape8()
+    ToTape8Processor()
     {
         reset();
     }
@@ -86,8 +94,10 @@ public:
         iirEnc = compEnc = avgEnc = 0.0;
         iirDec = compDec = avgDec = 0.0;
 
-        for (int i = 0; i < 1002; ++i)
-            delayBuffer[i] = 0.0;
+        // Flutter delay line is allocated in setSampleRate() (prepareToPlay), so a
+        // freshly constructed instance has nothing to clear yet
+        if (delayBuffer != nullptr)
+            delayBuffer.clear (static_cast<size_t> (delayBufferSize));
         gcount = 0;
         sweep = 0.0;
         phantomSweep = 3.14159265358979323846;  // π radians offset
@@ -122,6 +132,11 @@ public:
     {
         currentSampleRate = sampleRate;
 
+        // Allocate the flutter delay line on first prepare (kept out of the constructor
+        // so plugin scans and session loads don't pay for it)
+        if (delayBuffer == nullptr)
+            delayBuffer.calloc (static_cast<size_t> (delayBufferSize));
+
         overallscale = 1.0 / 44100.0 * currentSampleRate;
         spacing = static_cast<int> (std::floor (overallscale));
         if (spacing < 1) spacing = 1;
@@ -190,47 +205,52 @@ public:
         outputGain = I * 2.0;
     }
 
+    /** Heap memory allocated by setSampleRate() (flutter delay line). */
+    static constexpr size_t getHeapBytes() { return sizeof (FloatType) * static_cast<size_t> (delayBufferSize); }
+
     //==============================================================================
-    float process (float input, float driveDB)
+    template <typename SampleType>
+    SampleType process (SampleType input, float driveDB)
     {
-        double inputSample = input;
-        if (std::fabs (inputSample) < 1.18e-23)
-            inputSample = fpd * 1.18e-17;
+        jassert (delayBuffer != nullptr);  // setSampleRate() allocates the flutter delay line
+
+        FloatType inputSample = input;
+        Denormals::replaceIfTiny<Policy> (inputSample, fpd);
 
         // New behavior: negative drive = volume only, positive drive = algorithm drive
-        double A;
-        if (driveDB < 0.0)
+        FloatType A;
+        if (driveDB < FloatType (0.0))
         {
             // Negative drive: just attenuate volume, keep algorithm at neutral (A = 0.5)
-            double volumeGain = std::pow (10.0, driveDB / 20.0);
+            FloatType volumeGain = std::pow (FloatType (10.0), driveDB / FloatType (20.0));
             inputSample *= volumeGain;
-            A = 0.5;  // Algorithm stays neutral
+            A = FloatType (0.5);  // Algorithm stays neutral
         }
         else
         {
             // Positive drive: map 0..+18 dB to A 0.5..1.0
-            A = 0.5 + (driveDB / 36.0);  // 0 dB → 0.5, +18 dB → 1.0
-            A = juce::jlimit (0.5, 1.0, A);
+            A = FloatType (0.5) + (driveDB / FloatType (36.0));  // 0 dB → 0.5, +18 dB → 1.0
+            A = juce::jlimit (FloatType (0.5), FloatType (1.0), A);
 
             // Apply input gain for algorithm
-            double inputGain = std::pow (A * 2.0, 2.0);
-            if (inputGain != 1.0)
+            FloatType inputGain = std::pow (A * FloatType (2.0), FloatType (2.0));
+            if (inputGain != FloatType (1.0))
                 inputSample *= inputGain;
         }
 
         // Dubly encode
-        iirEnc = (iirEnc * (1.0 - iirEncFreq)) + (inputSample * iirEncFreq);
-        double highPart = ((inputSample - iirEnc) * 2.848);
+        iirEnc = (iirEnc * (FloatType (1.0) - iirEncFreq)) + (inputSample * iirEncFreq);
+        FloatType highPart = ((inputSample - iirEnc) * FloatType (2.848));
         highPart += avgEnc;
-        avgEnc = (inputSample - iirEnc) * 1.152;
-        if (highPart > 1.0) highPart = 1.0;
-        if (highPart < -1.0) highPart = -1.0;
-        double dubly = std::fabs (highPart);
-        if (dubly > 0.0)
+        avgEnc = (inputSample - iirEnc) * FloatType (1.152);
+        if (highPart > FloatType (1.0)) highPart = FloatType (1.0);
+        if (highPart < -FloatType (1.0)) highPart = -FloatType (1.0);
+        FloatType dubly = std::fabs (highPart);
+        if (dubly > FloatType (0.0))
         {
-            double adjust = std::log (1.0 + (255.0 * dubly)) / 2.40823996531;
-            if (adjust > 0.0) dubly /= adjust;
-            compEnc = (compEnc * (1.0 - iirEncFreq)) + (dubly * iirEncFreq);
+            FloatType adjust = std::log (FloatType (1.0) + (FloatType (255.0) * dubly)) / FloatType (2.40823996531);
+            if (adjust > FloatType (0.0)) dubly /= adjust;
+            compEnc = (compEnc * (FloatType (1.0) - iirEncFreq)) + (dubly * iirEncFreq);
             inputSample += ((highPart * compEnc) * dublyAmount);
         }
 
@@ -275,25 +295,26 @@ public:
                     phantomNextmax = phantomFlutB;
             }
             count += static_cast<int> (std::floor (offset));
-            inputSample = (delayBuffer[count - ((count > 999) ? 1000 : 0)] * (1.0 - (offset - std::floor (offset))));
-            inputSample += (delayBuffer[count + 1 - ((count + 1 > 999) ? 1000 : 0)] * (offset - std::floor (offset)));
+            const auto fraction = static_cast<FloatType> (offset - std::floor (offset));
+            inputSample = (delayBuffer[count - ((count > 999) ? 1000 : 0)] * (FloatType (1.0) - fraction));
+            inputSample += (delayBuffer[count + 1 - ((count + 1 > 999) ? 1000 : 0)] * fraction);
             gcount--;
         }
 
         // Bias routine
         // In the original stereo code: gslew[x]=prevSampL, gslew[x+1]=prevSampR, gslew[x+2]=threshold
         // In mono: gslew[x]=prevSamp, gslew[x+1]=threshold (no x+2!)
-        if (std::fabs (bias) > 0.001)
+        if (std::fabs (bias) > FloatType (0.001))
         {
             for (int x = 0; x < gslew_total; x += 2)
             {
-                double currentThreshold = gslew[x + 1];  // threshold is at x+1 for mono
+                FloatType currentThreshold = gslew[x + 1];  // threshold is at x+1 for mono
 
-                if (underBias > 0.0)
+                if (underBias > FloatType (0.0))
                 {
-                    double stuck = std::fabs (inputSample - (gslew[x] / 0.975)) / underBias;
-                    if (stuck < 1.0)
-                        inputSample = (inputSample * stuck) + ((gslew[x] / 0.975) * (1.0 - stuck));
+                    FloatType stuck = std::fabs (inputSample - (gslew[x] / FloatType (0.975))) / underBias;
+                    if (stuck < FloatType (1.0))
+                        inputSample = (inputSample * stuck) + ((gslew[x] / FloatType (0.975)) * (FloatType (1.0) - stuck));
                 }
 
                 // Use currentThreshold instead of gslew[x+2] (which doesn't exist in mono!)
@@ -302,34 +323,34 @@ public:
                 if (-(inputSample - gslew[x]) > currentThreshold)
                     inputSample = gslew[x] - currentThreshold;
 
-                gslew[x] = inputSample * 0.975;
+                gslew[x] = inputSample * FloatType (0.975);
             }
         }
 
         // toTape basic algorithm
-        iirMidRoller = (iirMidRoller * (1.0 - iirMidFreq)) + (inputSample * iirMidFreq);
-        double HighsSample = inputSample - iirMidRoller;
-        double LowsSample = iirMidRoller;
+        iirMidRoller = (iirMidRoller * (FloatType (1.0) - iirMidFreq)) + (inputSample * iirMidFreq);
+        FloatType HighsSample = inputSample - iirMidRoller;
+        FloatType LowsSample = iirMidRoller;
 
-        if (iirSubFreq > 0.0)
+        if (iirSubFreq > FloatType (0.0))
         {
-            iirLowCutoff = (iirLowCutoff * (1.0 - iirSubFreq)) + (LowsSample * iirSubFreq);
+            iirLowCutoff = (iirLowCutoff * (FloatType (1.0) - iirSubFreq)) + (LowsSample * iirSubFreq);
             LowsSample -= iirLowCutoff;
         }
 
-        if (LowsSample > 1.57079633) LowsSample = 1.57079633;
-        if (LowsSample < -1.57079633) LowsSample = -1.57079633;
+        if (LowsSample > FloatType (1.57079633)) LowsSample = FloatType (1.57079633);
+        if (LowsSample < -FloatType (1.57079633)) LowsSample = -FloatType (1.57079633);
         LowsSample = std::sin (LowsSample);
 
-        double thinnedHighSample = std::fabs (HighsSample) * 1.57079633;
-        if (thinnedHighSample > 1.57079633) thinnedHighSample = 1.57079633;
-        thinnedHighSample = 1.0 - std::cos (thinnedHighSample);
+        FloatType thinnedHighSample = std::fabs (HighsSample) * FloatType (1.57079633);
+        if (thinnedHighSample > FloatType (1.57079633)) thinnedHighSample = FloatType (1.57079633);
+        thinnedHighSample = FloatType (1.0) - std::cos (thinnedHighSample);
         if (HighsSample < 0) thinnedHighSample = -thinnedHighSample;
         HighsSample -= thinnedHighSample;
 
-        // HeadBump
+        // HeadBump (resonator kept in double: low-frequency biquad near the unit circle)
         double headBumpSample = 0.0;
-        if (headBumpMix > 0.0)
+        if (headBumpMix > FloatType (0.0))
         {
             headBump += (LowsSample * headBumpDrive);
             headBump -= (headBump * headBump * headBump * (0.0618 / std::sqrt (overallscale)));
@@ -341,57 +362,57 @@ public:
             hdbB[hdb_s2] = (headBiqSample * hdbB[hdb_a2]) - (headBumpSample * hdbB[hdb_b2]);
         }
 
-        inputSample = LowsSample + HighsSample + (headBumpSample * headBumpMix);
+        inputSample = LowsSample + HighsSample + static_cast<FloatType> (headBumpSample * headBumpMix);
 
         // Dubly decode
-        iirDec = (iirDec * (1.0 - iirDecFreq)) + (inputSample * iirDecFreq);
-        highPart = ((inputSample - iirDec) * 2.628);
+        iirDec = (iirDec * (FloatType (1.0) - iirDecFreq)) + (inputSample * iirDecFreq);
+        highPart = ((inputSample - iirDec) * FloatType (2.628));
         highPart += avgDec;
-        avgDec = (inputSample - iirDec) * 1.372;
-        if (highPart > 1.0) highPart = 1.0;
-        if (highPart < -1.0) highPart = -1.0;
+        avgDec = (inputSample - iirDec) * FloatType (1.372);
+        if (highPart > FloatType (1.0)) highPart = FloatType (1.0);
+        if (highPart < -FloatType (1.0)) highPart = -FloatType (1.0);
         dubly = std::fabs (highPart);
-        if (dubly > 0.0)
+        if (dubly > FloatType (0.0))
         {
-            double adjust = std::log (1.0 + (255.0 * dubly)) / 2.40823996531;
-            if (adjust > 0.0) dubly /= adjust;
-            compDec = (compDec * (1.0 - iirDecFreq)) + (dubly * iirDecFreq);
+            FloatType adjust = std::log (FloatType (1.0) + (FloatType (255.0) * dubly)) / FloatType (2.40823996531);
+            if (adjust > FloatType (0.0)) dubly /= adjust;
+            compDec = (compDec * (FloatType (1.0) - iirDecFreq)) + (dubly * iirDecFreq);
             inputSample += ((highPart * compDec) * outlyAmount);
         }
 
-        if (outputGain != 1.0)
+        if (outputGain != FloatType (1.0))
             inputSample *= outputGain;
 
         // ClipOnly2
-        if (inputSample > 4.0) inputSample = 4.0;
-        if (inputSample < -4.0) inputSample = -4.0;
+        if (inputSample > FloatType (4.0)) inputSample = FloatType (4.0);
+        if (inputSample < -FloatType (4.0)) inputSample = -FloatType (4.0);
 
         if (wasPosClip)
         {
             if (inputSample < lastSample)
-                lastSample = 0.7058208 + (inputSample * 0.2609148);
+                lastSample = FloatType (0.7058208) + (inputSample * FloatType (0.2609148));
             else
-                lastSample = 0.2491717 + (lastSample * 0.7390851);
+                lastSample = FloatType (0.2491717) + (lastSample * FloatType (0.7390851));
         }
         wasPosClip = false;
-        if (inputSample > 0.9549925859)
+        if (inputSample > FloatType (0.9549925859))
         {
             wasPosClip = true;
-            inputSample = 0.7058208 + (lastSample * 0.2609148);
+            inputSample = FloatType (0.7058208) + (lastSample * FloatType (0.2609148));
         }
 
         if (wasNegClip)
         {
             if (inputSample > lastSample)
-                lastSample = -0.7058208 + (inputSample * 0.2609148);
+                lastSample = -FloatType (0.7058208) + (inputSample * FloatType (0.2609148));
             else
-                lastSample = -0.2491717 + (lastSample * 0.7390851);
+                lastSample = -FloatType (0.2491717) + (lastSample * FloatType (0.7390851));
         }
         wasNegClip = false;
-        if (inputSample < -0.9549925859)
+        if (inputSample < -FloatType (0.9549925859))
         {
             wasNegClip = true;
-            inputSample = -0.7058208 + (lastSample * 0.2609148);
+            inputSample = -FloatType (0.7058208) + (lastSample * FloatType (0.2609148));
         }
 
         intermediate[spacing] = inputSample;
@@ -400,39 +421,40 @@ public:
             intermediate[x - 1] = intermediate[x];
         lastSample = intermediate[0];
 
-        return static_cast<float> (inputSample);
+        return static_cast<SampleType> (inputSample);
     }
 
 private:
     //==============================================================================
     double currentSampleRate = 44100.0;
-    double overallscale = 1.0;
+    FloatType overallscale = 1.0;
     int spacing = 1;
 
     // Fixed parameters (set in setSampleRate)
-    double dublyAmount, outlyAmount;
-    double iirEncFreq, iirDecFreq, iirMidFreq;
+    FloatType dublyAmount, outlyAmount;
+    FloatType iirEncFreq, iirDecFreq, iirMidFreq;
     double flutDepth, flutFrequency;
-    double bias, underBias;  // Bias routine parameters
-    double headBumpDrive, headBumpMix, iirSubFreq;
-    double outputGain;
+    FloatType bias, underBias;  // Bias routine parameters
+    FloatType headBumpDrive, headBumpMix, iirSubFreq;
+    FloatType outputGain;
 
     // Dubly state
-    double iirEnc, iirDec;
-    double compEnc, compDec;
-    double avgEnc, avgDec;
+    FloatType iirEnc, iirDec;
+    FloatType compEnc, compDec;
+    FloatType avgEnc, avgDec;
 
     // Flutter state
-    double delayBuffer[1002];  // 1002 samples (not 1000) to prevent overflow when accessing count+1
+    static constexpr int delayBufferSize = 1002;  // 1002 samples (not 1000) to prevent overflow when accessing count+1
+    juce::HeapBlock<FloatType> delayBuffer;         // Allocated in setSampleRate()
     int gcount;
     double sweep, nextmax;
     double phantomSweep, phantomNextmax;  // Phantom channel for cross-coupling (mimics stereo behavior)
 
     // Bias state
-    double gslew[gslew_total];
+    FloatType gslew[gslew_total];
 
     // toTape state
-    double iirMidRoller, iirLowCutoff;
+    FloatType iirMidRoller, iirLowCutoff;
 
     // HeadBump state
     double headBump;
@@ -440,12 +462,16 @@ private:
     double hdbB[hdb_total];
 
     // ClipOnly2 state
-    double lastSample;
-    double intermediate[16];
+    FloatType lastSample;
+    FloatType intermediate[16];
     bool wasPosClip, wasNegClip;
 
     // PRNG
     uint32_t fpd;
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ToTape8)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ToTape8Processor)
 };
+
+//==============================================================================
+using ToTape8 = ToTape8Processor<double>;
+using ToTape8Float = ToTape8Processor<float>;
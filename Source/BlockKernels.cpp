@@ -0,0 +1,508 @@
+/*
+  ==============================================================================
+
+    BlockKernels.cpp
+    Hot block kernels with runtime CPU dispatch
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    Each variant is compiled with its own target attribute (GCC/Clang) so the
+    translation unit itself needs no ISA flags; MSVC accepts the intrinsics
+    without them. The baseline variant is always built.
+
+  ==============================================================================
+*/
+
+#include "BlockKernels.h"
+#include <JuceHeader.h>
+#include <cmath>
+
+#if JUCE_INTEL
+ #include <immintrin.h>
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <cpuid.h>
+ #endif
+ #define ANALOGCHANNEL_X86_KERNELS 1
+#elif JUCE_ARM && (defined (__ARM_NEON__) || defined (__ARM_NEON))
+ #include <arm_neon.h>
+ #define ANALOGCHANNEL_NEON_KERNELS 1
+#endif
+
+#if JUCE_GCC || JUCE_CLANG
+ #define ANALOGCHANNEL_TARGET(isa) __attribute__ ((target (isa)))
+#else
+ #define ANALOGCHANNEL_TARGET(isa)
+#endif
+
+namespace BlockKernels
+{
+namespace
+{
+    //==============================================================================
+    // Portable C++ (fallback, and the tails of the vector loops)
+    float dotProductScalar (const float* a, const float* b, int numSamples)
+    {
+        float sum = 0.0f;
+        for (int i = 0; i < numSamples; ++i)
+            sum += a[i] * b[i];
+        return sum;
+    }
+
+    float sumOfSquaresScalar (const float* data, int numSamples)
+    {
+        float sum = 0.0f;
+        for (int i = 0; i < numSamples; ++i)
+            sum += data[i] * data[i];
+        return sum;
+    }
+
+    float sumOfAbsolutesScalar (const float* data, int numSamples)
+    {
+        float sum = 0.0f;
+        for (int i = 0; i < numSamples; ++i)
+            sum += std::abs (data[i]);
+        return sum;
+    }
+
+    float findPeakScalar (const float* data, int numSamples)
+    {
+        float peak = 0.0f;
+        for (int i = 0; i < numSamples; ++i)
+            peak = juce::jmax (peak, std::abs (data[i]));
+        return peak;
+    }
+
+    double sumOfSquaresScalar (const double* data, int numSamples)
+    {
+        double sum = 0.0;
+        for (int i = 0; i < numSamples; ++i)
+            sum += data[i] * data[i];
+        return sum;
+    }
+
+    double findPeakScalar (const double* data, int numSamples)
+    {
+        double peak = 0.0;
+        for (int i = 0; i < numSamples; ++i)
+            peak = juce::jmax (peak, std::abs (data[i]));
+        return peak;
+    }
+
+   #if ANALOGCHANNEL_X86_KERNELS
+    //==============================================================================
+    // SSE2 (x86-64 baseline)
+    ANALOGCHANNEL_TARGET ("sse2") inline float horizontalSum4 (__m128 v)
+    {
+        v = _mm_add_ps (v, _mm_movehl_ps (v, v));
+        v = _mm_add_ss (v, _mm_shuffle_ps (v, v, 1));
+        return _mm_cvtss_f32 (v);
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") inline float horizontalMax4 (__m128 v)
+    {
+        v = _mm_max_ps (v, _mm_movehl_ps (v, v));
+        v = _mm_max_ss (v, _mm_shuffle_ps (v, v, 1));
+        return _mm_cvtss_f32 (v);
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") inline __m128 absoluteSSE2 (__m128 v)
+    {
+        return _mm_and_ps (v, _mm_castsi128_ps (_mm_set1_epi32 (0x7fffffff)));
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") float dotProductSSE2 (const float* a, const float* b, int numSamples)
+    {
+        __m128 acc = _mm_setzero_ps();
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+            acc = _mm_add_ps (acc, _mm_mul_ps (_mm_loadu_ps (a + i), _mm_loadu_ps (b + i)));
+        return horizontalSum4 (acc) + dotProductScalar (a + i, b + i, numSamples - i);
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") float sumOfSquaresSSE2 (const float* data, int numSamples)
+    {
+        __m128 acc = _mm_setzero_ps();
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const __m128 x = _mm_loadu_ps (data + i);
+            acc = _mm_add_ps (acc, _mm_mul_ps (x, x));
+        }
+        return horizontalSum4 (acc) + sumOfSquaresScalar (data + i, numSamples - i);
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") float sumOfAbsolutesSSE2 (const float* data, int numSamples)
+    {
+        __m128 acc = _mm_setzero_ps();
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+            acc = _mm_add_ps (acc, absoluteSSE2 (_mm_loadu_ps (data + i)));
+        return horizontalSum4 (acc) + sumOfAbsolutesScalar (data + i, numSamples - i);
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") float findPeakSSE2 (const float* data, int numSamples)
+    {
+        __m128 peak = _mm_setzero_ps();
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+            peak = _mm_max_ps (peak, absoluteSSE2 (_mm_loadu_ps (data + i)));
+        return juce::jmax (horizontalMax4 (peak), findPeakScalar (data + i, numSamples - i));
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") inline __m128d absoluteSSE2 (__m128d v)
+    {
+        return _mm_and_pd (v, _mm_castsi128_pd (_mm_set1_epi64x (0x7fffffffffffffffLL)));
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") double sumOfSquaresSSE2 (const double* data, int numSamples)
+    {
+        __m128d acc = _mm_setzero_pd();
+        int i = 0;
+        for (; i + 2 <= numSamples; i += 2)
+        {
+            const __m128d x = _mm_loadu_pd (data + i);
+            acc = _mm_add_pd (acc, _mm_mul_pd (x, x));
+        }
+        acc = _mm_add_sd (acc, _mm_unpackhi_pd (acc, acc));
+        return _mm_cvtsd_f64 (acc) + sumOfSquaresScalar (data + i, numSamples - i);
+    }
+
+    ANALOGCHANNEL_TARGET ("sse2") double findPeakSSE2 (const double* data, int numSamples)
+    {
+        __m128d peak = _mm_setzero_pd();
+        int i = 0;
+        for (; i + 2 <= numSamples; i += 2)
+            peak = _mm_max_pd (peak, absoluteSSE2 (_mm_loadu_pd (data + i)));
+        peak = _mm_max_sd (peak, _mm_unpackhi_pd (peak, peak));
+        return juce::jmax (_mm_cvtsd_f64 (peak), findPeakScalar (data + i, numSamples - i));
+    }
+
+    //==============================================================================
+    // AVX2 + FMA
+    ANALOGCHANNEL_TARGET ("avx2,fma") inline float horizontalSum8 (__m256 v)
+    {
+        __m128 sum = _mm_add_ps (_mm256_castps256_ps128 (v), _mm256_extractf128_ps (v, 1));
+        sum = _mm_add_ps (sum, _mm_movehl_ps (sum, sum));
+        sum = _mm_add_ss (sum, _mm_shuffle_ps (sum, sum, 1));
+        return _mm_cvtss_f32 (sum);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") inline float horizontalMax8 (__m256 v)
+    {
+        __m128 peak = _mm_max_ps (_mm256_castps256_ps128 (v), _mm256_extractf128_ps (v, 1));
+        peak = _mm_max_ps (peak, _mm_movehl_ps (peak, peak));
+        peak = _mm_max_ss (peak, _mm_shuffle_ps (peak, peak, 1));
+        return _mm_cvtss_f32 (peak);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") inline __m256 absoluteAVX2 (__m256 v)
+    {
+        return _mm256_and_ps (v, _mm256_castsi256_ps (_mm256_set1_epi32 (0x7fffffff)));
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") float dotProductAVX2 (const float* a, const float* b, int numSamples)
+    {
+        // Two accumulators hide the FMA latency
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+        int i = 0;
+        for (; i + 16 <= numSamples; i += 16)
+        {
+            acc0 = _mm256_fmadd_ps (_mm256_loadu_ps (a + i), _mm256_loadu_ps (b + i), acc0);
+            acc1 = _mm256_fmadd_ps (_mm256_loadu_ps (a + i + 8), _mm256_loadu_ps (b + i + 8), acc1);
+        }
+        for (; i + 8 <= numSamples; i += 8)
+            acc0 = _mm256_fmadd_ps (_mm256_loadu_ps (a + i), _mm256_loadu_ps (b + i), acc0);
+        return horizontalSum8 (_mm256_add_ps (acc0, acc1)) + dotProductScalar (a + i, b + i, numSamples - i);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") float sumOfSquaresAVX2 (const float* data, int numSamples)
+    {
+        __m256 acc = _mm256_setzero_ps();
+        int i = 0;
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const __m256 x = _mm256_loadu_ps (data + i);
+            acc = _mm256_fmadd_ps (x, x, acc);
+        }
+        return horizontalSum8 (acc) + sumOfSquaresScalar (data + i, numSamples - i);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") float sumOfAbsolutesAVX2 (const float* data, int numSamples)
+    {
+        __m256 acc = _mm256_setzero_ps();
+        int i = 0;
+        for (; i + 8 <= numSamples; i += 8)
+            acc = _mm256_add_ps (acc, absoluteAVX2 (_mm256_loadu_ps (data + i)));
+        return horizontalSum8 (acc) + sumOfAbsolutesScalar (data + i, numSamples - i);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") float findPeakAVX2 (const float* data, int numSamples)
+    {
+        __m256 peak = _mm256_setzero_ps();
+        int i = 0;
+        for (; i + 8 <= numSamples; i += 8)
+            peak = _mm256_max_ps (peak, absoluteAVX2 (_mm256_loadu_ps (data + i)));
+        return juce::jmax (horizontalMax8 (peak), findPeakScalar (data + i, numSamples - i));
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") inline __m256d absoluteAVX2 (__m256d v)
+    {
+        return _mm256_and_pd (v, _mm256_castsi256_pd (_mm256_set1_epi64x (0x7fffffffffffffffLL)));
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") double sumOfSquaresAVX2 (const double* data, int numSamples)
+    {
+        __m256d acc = _mm256_setzero_pd();
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const __m256d x = _mm256_loadu_pd (data + i);
+            acc = _mm256_fmadd_pd (x, x, acc);
+        }
+        __m128d sum = _mm_add_pd (_mm256_castpd256_pd128 (acc), _mm256_extractf128_pd (acc, 1));
+        sum = _mm_add_sd (sum, _mm_unpackhi_pd (sum, sum));
+        return _mm_cvtsd_f64 (sum) + sumOfSquaresScalar (data + i, numSamples - i);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx2,fma") double findPeakAVX2 (const double* data, int numSamples)
+    {
+        __m256d peak = _mm256_setzero_pd();
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+            peak = _mm256_max_pd (peak, absoluteAVX2 (_mm256_loadu_pd (data + i)));
+        __m128d peak2 = _mm_max_pd (_mm256_castpd256_pd128 (peak), _mm256_extractf128_pd (peak, 1));
+        peak2 = _mm_max_sd (peak2, _mm_unpackhi_pd (peak2, peak2));
+        return juce::jmax (_mm_cvtsd_f64 (peak2), findPeakScalar (data + i, numSamples - i));
+    }
+
+    //==============================================================================
+    // AVX-512F (tails handled with masked loads)
+    // NOTE: GCC 12 reports false "uninitialized" warnings from inside its own
+    // avx512fintrin.h (_mm512_undefined_ps temporaries in max/reduce)
+    JUCE_BEGIN_IGNORE_WARNINGS_GCC_LIKE ("-Wuninitialized", "-Wmaybe-uninitialized")
+
+    ANALOGCHANNEL_TARGET ("avx512f") inline __mmask16 tailMask (int remaining)
+    {
+        return static_cast<__mmask16> ((1u << remaining) - 1u);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx512f") float dotProductAVX512 (const float* a, const float* b, int numSamples)
+    {
+        __m512 acc = _mm512_setzero_ps();
+        int i = 0;
+        for (; i + 16 <= numSamples; i += 16)
+            acc = _mm512_fmadd_ps (_mm512_loadu_ps (a + i), _mm512_loadu_ps (b + i), acc);
+        if (i < numSamples)
+        {
+            const __mmask16 mask = tailMask (numSamples - i);
+            acc = _mm512_fmadd_ps (_mm512_maskz_loadu_ps (mask, a + i), _mm512_maskz_loadu_ps (mask, b + i), acc);
+        }
+        return _mm512_reduce_add_ps (acc);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx512f") float sumOfSquaresAVX512 (const float* data, int numSamples)
+    {
+        __m512 acc = _mm512_setzero_ps();
+        int i = 0;
+        for (; i + 16 <= numSamples; i += 16)
+        {
+            const __m512 x = _mm512_loadu_ps (data + i);
+            acc = _mm512_fmadd_ps (x, x, acc);
+        }
+        if (i < numSamples)
+        {
+            const __m512 x = _mm512_maskz_loadu_ps (tailMask (numSamples - i), data + i);
+            acc = _mm512_fmadd_ps (x, x, acc);
+        }
+        return _mm512_reduce_add_ps (acc);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx512f") float sumOfAbsolutesAVX512 (const float* data, int numSamples)
+    {
+        __m512 acc = _mm512_setzero_ps();
+        int i = 0;
+        for (; i + 16 <= numSamples; i += 16)
+            acc = _mm512_add_ps (acc, _mm512_abs_ps (_mm512_loadu_ps (data + i)));
+        if (i < numSamples)
+            acc = _mm512_add_ps (acc, _mm512_abs_ps (_mm512_maskz_loadu_ps (tailMask (numSamples - i), data + i)));
+        return _mm512_reduce_add_ps (acc);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx512f") float findPeakAVX512 (const float* data, int numSamples)
+    {
+        __m512 peak = _mm512_setzero_ps();
+        int i = 0;
+        for (; i + 16 <= numSamples; i += 16)
+            peak = _mm512_max_ps (peak, _mm512_abs_ps (_mm512_loadu_ps (data + i)));
+        if (i < numSamples)
+            peak = _mm512_max_ps (peak, _mm512_abs_ps (_mm512_maskz_loadu_ps (tailMask (numSamples - i), data + i)));
+        return _mm512_reduce_max_ps (peak);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx512f") double sumOfSquaresAVX512 (const double* data, int numSamples)
+    {
+        __m512d acc = _mm512_setzero_pd();
+        int i = 0;
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const __m512d x = _mm512_loadu_pd (data + i);
+            acc = _mm512_fmadd_pd (x, x, acc);
+        }
+        if (i < numSamples)
+        {
+            const __m512d x = _mm512_maskz_loadu_pd (static_cast<__mmask8> (tailMask (numSamples - i)), data + i);
+            acc = _mm512_fmadd_pd (x, x, acc);
+        }
+        return _mm512_reduce_add_pd (acc);
+    }
+
+    ANALOGCHANNEL_TARGET ("avx512f") double findPeakAVX512 (const double* data, int numSamples)
+    {
+        __m512d peak = _mm512_setzero_pd();
+        int i = 0;
+        for (; i + 8 <= numSamples; i += 8)
+            peak = _mm512_max_pd (peak, _mm512_abs_pd (_mm512_loadu_pd (data + i)));
+        if (i < numSamples)
+            peak = _mm512_max_pd (peak, _mm512_abs_pd (_mm512_maskz_loadu_pd (static_cast<__mmask8> (tailMask (numSamples - i)), data + i)));
+        return _mm512_reduce_max_pd (peak);
+    }
+
+    JUCE_END_IGNORE_WARNINGS_GCC_LIKE
+
+    //==============================================================================
+    // OS support: the kernels may only use registers the OS saves on context
+    // switches. XGETBV is valid once the OS has enabled XSAVE (CPUID.1:ECX.OSXSAVE).
+    constexpr unsigned long long xcr0AVXState    = 0x06;  // XMM | YMM
+    constexpr unsigned long long xcr0AVX512State = 0xe6;  // XMM | YMM | opmask | ZMM_Hi256 | Hi16_ZMM
+
+    bool isOSXSAVEEnabled()
+    {
+       #if JUCE_MSVC
+        int info[4] {};
+        __cpuid (info, 1);
+        return (info[2] & (1 << 27)) != 0;
+       #else
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        return __get_cpuid (1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 27)) != 0;
+       #endif
+    }
+
+    ANALOGCHANNEL_TARGET ("xsave") unsigned long long readXCR0()
+    {
+        return isOSXSAVEEnabled() ? static_cast<unsigned long long> (_xgetbv (0)) : 0;
+    }
+
+    bool isRegisterStateEnabled (unsigned long long stateMask)
+    {
+        return (readXCR0() & stateMask) == stateMask;
+    }
+   #endif
+
+   #if ANALOGCHANNEL_NEON_KERNELS
+    //==============================================================================
+    // NEON
+    inline float horizontalSum (float32x4_t v)
+    {
+        const float32x2_t pair = vadd_f32 (vget_low_f32 (v), vget_high_f32 (v));
+        return vget_lane_f32 (vpadd_f32 (pair, pair), 0);
+    }
+
+    inline float horizontalMax (float32x4_t v)
+    {
+        const float32x2_t pair = vmax_f32 (vget_low_f32 (v), vget_high_f32 (v));
+        return vget_lane_f32 (vpmax_f32 (pair, pair), 0);
+    }
+
+    float dotProductNEON (const float* a, const float* b, int numSamples)
+    {
+        float32x4_t acc = vdupq_n_f32 (0.0f);
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+            acc = vmlaq_f32 (acc, vld1q_f32 (a + i), vld1q_f32 (b + i));
+        return horizontalSum (acc) + dotProductScalar (a + i, b + i, numSamples - i);
+    }
+
+    float sumOfSquaresNEON (const float* data, int numSamples)
+    {
+        float32x4_t acc = vdupq_n_f32 (0.0f);
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const float32x4_t x = vld1q_f32 (data + i);
+            acc = vmlaq_f32 (acc, x, x);
+        }
+        return horizontalSum (acc) + sumOfSquaresScalar (data + i, numSamples - i);
+    }
+
+    float sumOfAbsolutesNEON (const float* data, int numSamples)
+    {
+        float32x4_t acc = vdupq_n_f32 (0.0f);
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+            acc = vaddq_f32 (acc, vabsq_f32 (vld1q_f32 (data + i)));
+        return horizontalSum (acc) + sumOfAbsolutesScalar (data + i, numSamples - i);
+    }
+
+    float findPeakNEON (const float* data, int numSamples)
+    {
+        float32x4_t peak = vdupq_n_f32 (0.0f);
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+            peak = vmaxq_f32 (peak, vabsq_f32 (vld1q_f32 (data + i)));
+        return juce::jmax (horizontalMax (peak), findPeakScalar (data + i, numSamples - i));
+    }
+   #endif
+
+    //==============================================================================
+    struct KernelTable
+    {
+        const char* name;
+        float (*dotProduct) (const float*, const float*, int);
+        float (*sumOfSquares) (const float*, int);
+        float (*sumOfAbsolutes) (const float*, int);
+        float (*findPeak) (const float*, int);
+        double (*sumOfSquaresDouble) (const double*, int);
+        double (*findPeakDouble) (const double*, int);
+    };
+
+    KernelTable selectKernels()
+    {
+       #if ANALOGCHANNEL_X86_KERNELS
+        if (juce::SystemStats::hasAVX512F() && isRegisterStateEnabled (xcr0AVX512State))
+            return { "AVX-512F", dotProductAVX512, sumOfSquaresAVX512, sumOfAbsolutesAVX512, findPeakAVX512,
+                     sumOfSquaresAVX512, findPeakAVX512 };
+
+        if (juce::SystemStats::hasAVX2() && juce::SystemStats::hasFMA3() && isRegisterStateEnabled (xcr0AVXState))
+            return { "AVX2+FMA", dotProductAVX2, sumOfSquaresAVX2, sumOfAbsolutesAVX2, findPeakAVX2,
+                     sumOfSquaresAVX2, findPeakAVX2 };
+
+        if (juce::SystemStats::hasSSE2())
+            return { "SSE2", dotProductSSE2, sumOfSquaresSSE2, sumOfAbsolutesSSE2, findPeakSSE2,
+                     sumOfSquaresSSE2, findPeakSSE2 };
+       #elif ANALOGCHANNEL_NEON_KERNELS
+        // NEON kernels are float only (32-bit ARM has no double vectors)
+        return { "NEON", dotProductNEON, sumOfSquaresNEON, sumOfAbsolutesNEON, findPeakNEON,
+                 sumOfSquaresScalar, findPeakScalar };
+       #endif
+
+        return { "Scalar", dotProductScalar, sumOfSquaresScalar, sumOfAbsolutesScalar, findPeakScalar,
+                 sumOfSquaresScalar, findPeakScalar };
+    }
+
+    // Selected once when the binary is loaded (CPUID via juce::SystemStats, XCR0)
+    const KernelTable activeKernels = selectKernels();
+}
+
+//==============================================================================
+float dotProduct (const float* a, const float* b, int numSamples)  { return activeKernels.dotProduct (a, b, numSamples); }
+float sumOfSquares (const float* data, int numSamples)             { return activeKernels.sumOfSquares (data, numSamples); }
+float sumOfAbsolutes (const float* data, int numSamples)           { return activeKernels.sumOfAbsolutes (data, numSamples); }
+float findPeak (const float* data, int numSamples)                 { return activeKernels.findPeak (data, numSamples); }
+double sumOfSquares (const double* data, int numSamples)           { return activeKernels.sumOfSquaresDouble (data, numSamples); }
+double findPeak (const double* data, int numSamples)               { return activeKernels.findPeakDouble (data, numSamples); }
+const char* getVariantName()                                       { return activeKernels.name; }
+}
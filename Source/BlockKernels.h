@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    BlockKernels.h
+    Hot block kernels with runtime CPU dispatch
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    One plugin binary runs on every machine, so the kernels are compiled for
+    several instruction sets (SSE2 / AVX2+FMA / AVX-512F on x86, NEON on ARM,
+    plain C++ elsewhere) and the best variant the CPU supports is selected
+    once, when the plugin binary is loaded. AVX variants also need the OS to
+    save the wider registers (XCR0), not only the CPUID feature bits.
+
+    Only stateless block reductions live here (meter scans, detector levels,
+    FIR dot products). The per-sample recursions (biquads, saturation,
+    envelopes) are serial by nature and don't gain from wider vectors.
+
+    NOTE: Summation order depends on the variant, so results may differ in
+    the last bits between machines.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace BlockKernels
+{
+    /** Sum of a[i] * b[i]. */
+    float dotProduct (const float* a, const float* b, int numSamples);
+
+    /** Sum of data[i]^2. */
+    float sumOfSquares (const float* data, int numSamples);
+
+    /** Sum of |data[i]|. */
+    float sumOfAbsolutes (const float* data, int numSamples);
+
+    /** Largest |data[i]| (0 for an empty block). */
+    float findPeak (const float* data, int numSamples);
+
+    /** Double-precision versions for the 64-bit processing path. */
+    double sumOfSquares (const double* data, int numSamples);
+    double findPeak (const double* data, int numSamples);
+
+    /** Name of the variant selected for this CPU (e.g. "AVX2+FMA"). */
+    const char* getVariantName();
+}
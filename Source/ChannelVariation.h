@@ -9,7 +9,8 @@
 
     Implements subtle per-channel variations to emulate analog console
     channel-to-channel differences. 48 hardcoded presets generated with
-    pseudo-random values (seed: 9458) for consistent recall.
+    pseudo-random values (seed: 9458) for consistent recall; a compile-time
+    generator continues the table if more channel pairs become selectable.
 
   ==============================================================================
 */
@@ -17,6 +18,8 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 
 //==============================================================================
 /**
@@ -72,7 +75,7 @@ namespace ChannelVariations
 
     // 48 presets generated with seed 9458
     // Distribution: uniform random within ± max ranges
-    static const std::array<ChannelVariationPreset, NUM_CHANNELS> presets = {{
+    inline constexpr std::array<ChannelVariationPreset, NUM_CHANNELS> presets = {{
         // Channel 1
         {
             0.147f,    // eqTrebleGain
@@ -1034,4 +1037,149 @@ namespace ChannelVariations
         }
     }};
 
+    //==============================================================================
+    /**
+        Channels beyond the 48 presets, generated at compile time.
+
+        The offline generator behind the table above wasn't kept, and no
+        standard PRNG reproduces it from seed 9458, so channels 1-48 stay the
+        table (recall of existing sessions is unchanged) and the generator
+        takes over from channel 49: splitmix64 seeded with 9458 and the
+        channel index, uniform within the ranges of ChannelVariationPreset,
+        rounded to the table's precision. Each channel depends only on its
+        index, so raising MAX_CHANNELS never changes existing channels.
+
+        Only the selectable channels are built: MAX_CHANNELS follows the
+        channelPair parameter (NUM_PAIRS pairs), which today covers exactly
+        the table. Offering more pairs means raising NUM_PAIRS - the
+        parameter range follows it.
+    */
+    constexpr uint64_t SEED = 9458;
+    constexpr int NUM_PAIRS = 24;                   // channelPair: 0 to NUM_PAIRS - 1
+    constexpr int MAX_CHANNELS = NUM_PAIRS * 2;
+
+    namespace Generator
+    {
+        constexpr uint64_t next (uint64_t& state)
+        {
+            uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        }
+
+        /** Uniform in [-range, +range], rounded to a multiple of step. */
+        constexpr float offset (uint64_t& state, double range, double step)
+        {
+            const double unit = static_cast<double> (next (state) >> 11) * (1.0 / 9007199254740992.0);  // [0, 1)
+            const double value = (unit * 2.0 - 1.0) * range;
+            const auto steps = static_cast<int64_t> (value / step + (value < 0.0 ? -0.5 : 0.5));
+            return static_cast<float> (static_cast<double> (steps) * step);
+        }
+
+        constexpr ChannelVariationPreset makePreset (int channelIndex)
+        {
+            uint64_t state = SEED ^ (static_cast<uint64_t> (channelIndex) << 32);
+            ChannelVariationPreset preset {};
+
+            // Field order and ranges as in ChannelVariationPreset
+            preset.eqTrebleGain = offset (state, 0.3, 0.001);
+            preset.eqTrebleFreq = offset (state, 16.0, 0.01);
+            preset.eqBassGain   = offset (state, 0.3, 0.001);
+            preset.eqBassFreq   = offset (state, 10.0, 0.01);
+            preset.eqBell1Freq  = offset (state, 10.0, 0.01);
+            preset.eqBell1Gain  = offset (state, 0.35, 0.001);
+            preset.eqBell1Q     = offset (state, 0.06, 0.001);
+            preset.eqBell2Freq  = offset (state, 10.0, 0.01);
+            preset.eqBell2Gain  = offset (state, 0.35, 0.001);
+            preset.eqBell2Q     = offset (state, 0.06, 0.001);
+            preset.lpfFreq      = offset (state, 100.0, 0.1);
+            preset.lpfQ         = offset (state, 0.06, 0.001);
+            preset.hpfFreq      = offset (state, 8.0, 0.01);
+            preset.hpfQ         = offset (state, 0.06, 0.001);
+            preset.consoleDrive = offset (state, 0.25, 0.001);
+            preset.outputGain   = offset (state, 0.09, 0.001);
+
+            return preset;
+        }
+
+        template <int NumChannels>
+        constexpr std::array<ChannelVariationPreset, NumChannels> makePresets()
+        {
+            std::array<ChannelVariationPreset, NumChannels> table {};
+
+            for (int i = 0; i < NumChannels; ++i)
+                table[static_cast<std::size_t> (i)] = i < NUM_CHANNELS ? presets[static_cast<std::size_t> (i)] : makePreset (i);
+
+            return table;
+        }
+
+        //==============================================================================
+        // Compile-time checks (static_asserts below)
+        constexpr bool isEqual (const ChannelVariationPreset& a, const ChannelVariationPreset& b)
+        {
+            return a.eqTrebleGain == b.eqTrebleGain && a.eqTrebleFreq == b.eqTrebleFreq
+                && a.eqBassGain == b.eqBassGain && a.eqBassFreq == b.eqBassFreq
+                && a.eqBell1Freq == b.eqBell1Freq && a.eqBell1Gain == b.eqBell1Gain && a.eqBell1Q == b.eqBell1Q
+                && a.eqBell2Freq == b.eqBell2Freq && a.eqBell2Gain == b.eqBell2Gain && a.eqBell2Q == b.eqBell2Q
+                && a.lpfFreq == b.lpfFreq && a.lpfQ == b.lpfQ && a.hpfFreq == b.hpfFreq && a.hpfQ == b.hpfQ
+                && a.consoleDrive == b.consoleDrive && a.outputGain == b.outputGain;
+        }
+
+        constexpr bool isWithin (float value, float range)
+        {
+            return value >= -range && value <= range;
+        }
+
+        constexpr bool isWithinRanges (const ChannelVariationPreset& p)
+        {
+            return isWithin (p.eqTrebleGain, 0.3f) && isWithin (p.eqTrebleFreq, 16.0f)
+                && isWithin (p.eqBassGain, 0.3f) && isWithin (p.eqBassFreq, 10.0f)
+                && isWithin (p.eqBell1Freq, 10.0f) && isWithin (p.eqBell1Gain, 0.35f) && isWithin (p.eqBell1Q, 0.06f)
+                && isWithin (p.eqBell2Freq, 10.0f) && isWithin (p.eqBell2Gain, 0.35f) && isWithin (p.eqBell2Q, 0.06f)
+                && isWithin (p.lpfFreq, 100.0f) && isWithin (p.lpfQ, 0.06f) && isWithin (p.hpfFreq, 8.0f) && isWithin (p.hpfQ, 0.06f)
+                && isWithin (p.consoleDrive, 0.25f) && isWithin (p.outputGain, 0.09f);
+        }
+
+        template <std::size_t Size>
+        constexpr bool startsWithTable (const std::array<ChannelVariationPreset, Size>& table)
+        {
+            for (int i = 0; i < NUM_CHANNELS && i < static_cast<int> (Size); ++i)
+                if (! isEqual (table[static_cast<std::size_t> (i)], presets[static_cast<std::size_t> (i)]))
+                    return false;
+
+            return true;
+        }
+
+        /** The numChannels channels that raising NUM_PAIRS would add after the table. */
+        constexpr bool generatedChannelsAreValid (int numChannels)
+        {
+            auto preset = makePreset (NUM_CHANNELS);
+
+            for (int i = NUM_CHANNELS; i < NUM_CHANNELS + numChannels; ++i)
+            {
+                const auto nextPreset = makePreset (i + 1);
+
+                if (! isWithinRanges (preset) || isEqual (preset, nextPreset))
+                    return false;
+
+                preset = nextPreset;
+            }
+
+            return true;
+        }
+    }
+
+    /** Presets for channels 1 to MAX_CHANNELS (first 48 = presets), built by the compiler. */
+    inline constexpr std::array<ChannelVariationPreset, MAX_CHANNELS> allPresets = Generator::makePresets<MAX_CHANNELS>();
+
+    static_assert (MAX_CHANNELS >= NUM_CHANNELS, "Every channel of the table must stay selectable");
+    static_assert (Generator::startsWithTable (allPresets), "The first 48 channels must recall as the table");
+
+    // Headroom checks: up to 512 channels (256 pairs) the table stays as it is
+    // and every generated channel is in range and distinct from its neighbour
+    constexpr int MAX_CHECKED_CHANNELS = 512;
+    static_assert (Generator::startsWithTable (Generator::makePresets<MAX_CHECKED_CHANNELS>()), "Extending the table must not change it");
+    static_assert (Generator::generatedChannelsAreValid (MAX_CHECKED_CHANNELS - NUM_CHANNELS), "Generated channels must stay within the documented ranges");
+
 } // namespace ChannelVariations
@@ -5,6 +5,7 @@
     GUI component for Console section
     - Algorithm selector (Clean, Pure, Oxford, Essex, USA)
     - Drive knob
+    - Transfer curve / harmonics at the current drive
     - Bypass button
 
   ==============================================================================
@@ -15,6 +16,7 @@
 #include <JuceHeader.h>
 #include "Colors.h"
 #include "AnalogChannelLookAndFeel.h"
+#include "SaturationProfileDisplay.h"
 
 class ConsoleSectionComponent : public juce::Component,
                                  private juce::Button::Listener,
@@ -23,7 +25,8 @@ class ConsoleSectionComponent : public juce::Component,
 public:
     ConsoleSectionComponent (juce::AudioProcessorValueTreeState& apvts)
         : apvtsRef (apvts),
-          driveLAF (juce::Colour (0xff1a1a1a))  // Default dark/black
+          driveLAF (juce::Colour (0xff1a1a1a)),  // Default dark/black
+          profileDisplay (apvts, SaturationProfiler::Console)
     {
         // Apply dynamic colored LookAndFeel to drive knob
         driveKnob.setLookAndFeel (&driveLAF);
@@ -74,6 +77,9 @@ public:
         sectionLabel.setFont (juce::FontOptions (11.0f, juce::Font::bold));
         addAndMakeVisible (sectionLabel);
 
+        // Transfer curve / harmonics (updated from the editor's timer)
+        addAndMakeVisible (profileDisplay);
+
         // Initialize state
         updateBypassState();
     }
@@ -142,13 +148,20 @@ public:
 
         // Drive knob
         driveLabel.setBounds (bounds.removeFromTop (15));
-        driveKnob.setBounds (bounds.removeFromTop (80));
-        bounds.removeFromTop (10);
+        driveKnob.setBounds (bounds.removeFromTop (64));
+        bounds.removeFromTop (4);
+
+        // Transfer curve / harmonics
+        profileDisplay.setBounds (bounds.removeFromTop (SaturationProfileDisplay::HEIGHT));
 
         // Active button at bottom
         activeButton.setBounds (bounds.removeFromBottom (26));
     }
 
+    //==============================================================================
+    // Accessor for parent to update the saturation profile
+    SaturationProfileDisplay& getProfileDisplay() { return profileDisplay; }
+
 private:
     //==============================================================================
     void updateBypassState()
@@ -204,5 +217,8 @@ private:
     // Dynamic colored LookAndFeel for drive knob
     DynamicColoredKnobLookAndFeel driveLAF;
 
+    // Transfer curve / harmonics (measured off the audio thread)
+    SaturationProfileDisplay profileDisplay;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ConsoleSectionComponent)
 };
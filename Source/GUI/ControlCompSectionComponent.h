@@ -5,6 +5,7 @@
     GUI component for Control-Comp section (140px column)
     - Threshold knob
     - A/R toggle buttons (Fast/Normal)
+    - Stereo link selector (Off / Max / Sum)
     - GR LED meter strip
 
   ==============================================================================
@@ -47,6 +48,16 @@ public:
         arAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment> (
             apvts, "ctrlCompAR", arButton);
 
+        // Stereo link selector
+        // Parameter order: { "Off", "Max", "Sum" }
+        linkCombo.addItem ("Link Off", 1);
+        linkCombo.addItem ("Link Max", 2);
+        linkCombo.addItem ("Link Sum", 3);
+        addAndMakeVisible (linkCombo);
+
+        linkAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment> (
+            apvts, "ctrlCompLink", linkCombo);
+
         // GR meter
         addAndMakeVisible (grMeter);
 
@@ -126,8 +137,11 @@ public:
         thresholdKnob.setBounds (bounds.removeFromTop (80));
         bounds.removeFromTop (10);
 
-        // A/R toggle button (single button)
-        arButton.setBounds (bounds.removeFromTop (24));
+        // A/R toggle button and stereo link selector, side by side
+        auto arLinkArea = bounds.removeFromTop (24);
+        arButton.setBounds (arLinkArea.removeFromLeft (arLinkArea.getWidth() / 2 - 2));
+        arLinkArea.removeFromLeft (4);
+        linkCombo.setBounds (arLinkArea);
         bounds.removeFromTop (10);
 
         // GR meter
@@ -156,6 +170,7 @@ private:
         // Enable/disable controls
         thresholdKnob.setEnabled (isActive);
         arButton.setEnabled (isActive);
+        linkCombo.setEnabled (isActive);
         thresholdLabel.setAlpha (isActive ? 1.0f : 0.4f);
         grLabel.setAlpha (isActive ? 1.0f : 0.4f);
         sectionLabel.setAlpha (isActive ? 1.0f : 0.4f);
@@ -169,6 +184,7 @@ private:
     juce::Slider thresholdKnob;
     juce::Label thresholdLabel;
     juce::ToggleButton arButton;
+    juce::ComboBox linkCombo;
     LEDMeterStrip grMeter;
     juce::ToggleButton activeButton;
     juce::Label sectionLabel;
@@ -176,6 +192,7 @@ private:
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> thresholdAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> arAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> linkAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> bypassAttachment;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ControlCompSectionComponent)
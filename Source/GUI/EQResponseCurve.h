@@ -0,0 +1,272 @@
+/*
+  ==============================================================================
+
+    EQResponseCurve.h
+    Frequency response of the filters and EQ (20Hz - 20kHz, +-18dB)
+    Computed from the biquad coefficients, not measured from audio
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Colors.h"
+#include "../ParameterSnapshot.h"
+#include "../Sections/FilterSection.h"
+#include "../Sections/EQSection.h"
+#include <vector>
+
+/**
+    The curve keeps private FilterSection / EQSection instances (L and R) and
+    drives them from the APVTS through a ParameterSnapshot, exactly like the
+    processor does, channel variation offsets included. The curve is cached:
+    update() re-reads the parameters and only re-evaluates the sections'
+    responses (BiquadResponse.h) when one of their fields or the processing
+    rate changed. The audio thread's sections are never touched.
+
+    Points above 0.49 * the processing rate (sessions under 40kHz) are
+    evaluated there: the curve flattens out at the top instead of folding
+    back above Nyquist. Debug builds check the analytic response against
+    sines run through the private sections once per processing rate.
+*/
+class EQResponseCurve : public juce::Component
+{
+public:
+    static constexpr int numPoints = 512;
+
+    explicit EQResponseCurve (juce::AudioProcessorValueTreeState& apvts)
+    {
+        setInterceptsMouseClicks (false, false);
+
+        for (size_t i = 0; i < ParameterSnapshot::parameterIDs.size(); ++i)
+            sources[i] = apvts.getRawParameterValue (ParameterSnapshot::parameterIDs[i]);
+
+        // Log-spaced points, 20Hz - 20kHz
+        for (int i = 0; i < numPoints; ++i)
+            frequencies[static_cast<size_t> (i)] = minFrequency * std::pow (maxFrequency / minFrequency,
+                                                                            static_cast<double> (i) / (numPoints - 1));
+    }
+
+    //==============================================================================
+    /** Re-reads the parameters (message thread); recomputes the curve only on change. */
+    void update (double processingSampleRate)
+    {
+        snapshot.update (sources);
+
+        if (processingSampleRate > 0.0 && (response.getNumPoints() == 0 || processingSampleRate != response.getSampleRate()))
+        {
+            // Eco mode only drops to 44.1/48kHz, so only sessions under 40kHz clamp
+            for (size_t i = 0; i < frequencies.size(); ++i)
+                evaluatedFrequencies[i] = juce::jmin (frequencies[i], maxNyquistFraction * processingSampleRate);
+
+            response.setFrequencies (evaluatedFrequencies.data(), numPoints, processingSampleRate);
+
+            for (int ch = 0; ch < 2; ++ch)
+            {
+                filters[ch].setSampleRate (processingSampleRate);
+                eq[ch].setSampleRate (processingSampleRate);
+            }
+
+            snapshot.markAllChanged();
+           #if JUCE_DEBUG
+            sineCheckPending = true;
+           #endif
+        }
+
+        if (response.getNumPoints() == 0 || ! snapshot.hasChanged (curveFields))
+            return;
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            const auto variation = snapshot.getChannelVariation (ch);
+            filters[ch].applyParameters (snapshot, variation);
+            eq[ch].applyParameters (snapshot, variation);
+
+            std::fill (magnitudes[ch].begin(), magnitudes[ch].end(), 1.0);
+            filters[ch].multiplyMagnitudeResponse (response, magnitudes[ch].data());
+            eq[ch].multiplyMagnitudeResponse (response, magnitudes[ch].data());
+        }
+
+        snapshot.clearChanges();
+
+       #if JUCE_DEBUG
+        if (sineCheckPending)
+        {
+            sineCheckPending = false;
+            checkAgainstSineMeasurement (processingSampleRate);
+        }
+       #endif
+
+        // Stereo channel variation: the right channel is drawn only where it differs
+        showRightChannel = false;
+
+        for (size_t i = 0; i < magnitudes[0].size(); ++i)
+        {
+            const double left = magnitudes[0][i], right = magnitudes[1][i];
+            showRightChannel = showRightChannel || std::abs (left - right) > 1.0e-3 * juce::jmax (left, right);
+        }
+
+        repaint();
+    }
+
+    //==============================================================================
+    void paint (juce::Graphics& g) override
+    {
+        auto plot = getLocalBounds().toFloat();
+
+        g.setColour (AnalogChannelColors::BG_DARK);
+        g.fillRoundedRectangle (plot, 3.0f);
+
+        // Grid: 100Hz / 1kHz / 10kHz, 0dB
+        g.setColour (AnalogChannelColors::BORDER_LIGHT);
+
+        for (double freq : { 100.0, 1000.0, 10000.0 })
+        {
+            const float x = plot.getX() + static_cast<float> (std::log (freq / minFrequency) / std::log (maxFrequency / minFrequency)) * plot.getWidth();
+            g.drawVerticalLine (juce::roundToInt (x), plot.getY(), plot.getBottom());
+        }
+
+        g.drawHorizontalLine (juce::roundToInt (plot.getCentreY()), plot.getX(), plot.getRight());
+
+        if (response.getNumPoints() > 0)
+        {
+            if (showRightChannel)
+            {
+                g.setColour (AnalogChannelColors::TEXT_DIM);
+                g.strokePath (createCurve (magnitudes[1], plot), juce::PathStrokeType (1.0f));
+            }
+
+            g.setColour (AnalogChannelColors::TEXT_HIGHLIGHT);
+            g.strokePath (createCurve (magnitudes[0], plot), juce::PathStrokeType (1.5f));
+        }
+
+        g.setColour (AnalogChannelColors::BORDER_LIGHT);
+        g.drawRoundedRectangle (plot.reduced (0.5f), 3.0f, 1.0f);
+    }
+
+private:
+    //==============================================================================
+    static constexpr double minFrequency = 20.0;
+    static constexpr double maxFrequency = 20000.0;
+    static constexpr float maxDisplayDecibels = 18.0f;
+    static constexpr double maxNyquistFraction = 0.49;
+
+    using P = ParameterSnapshot;
+
+    // Fields the curve depends on
+    static constexpr uint64_t curveFields = P::mask (P::HpfFreq, P::HpfSlope, P::HpfQ, P::LpfFreq, P::LpfSlope, P::LpfQ, P::FiltersBypass,
+                                                     P::EqBass, P::EqBassFreq, P::EqTreble, P::EqTrebleFreq,
+                                                     P::EqBell1Freq, P::EqBell1Gain, P::EqBell2Freq, P::EqBell2Gain, P::EqBypass,
+                                                     P::EcoPrecision)
+                                            | P::channelVariationFields;
+
+    juce::Path createCurve (const std::array<double, numPoints>& channelMagnitudes, juce::Rectangle<float> plot) const
+    {
+        juce::Path path;
+
+        for (int i = 0; i < numPoints; ++i)
+        {
+            const float decibels = juce::jlimit (-maxDisplayDecibels, maxDisplayDecibels,
+                                                 juce::Decibels::gainToDecibels (static_cast<float> (channelMagnitudes[static_cast<size_t> (i)]), -100.0f));
+            const float x = plot.getX() + plot.getWidth() * static_cast<float> (i) / static_cast<float> (numPoints - 1);
+            const float y = juce::jmap (decibels, -maxDisplayDecibels, maxDisplayDecibels, plot.getBottom() - 1.0f, plot.getY() + 1.0f);
+
+            if (i == 0)
+                path.startNewSubPath (x, y);
+            else
+                path.lineTo (x, y);
+        }
+
+        return path;
+    }
+
+   #if JUCE_DEBUG
+    /**
+        Runs sines through the left channel's sections and compares their level
+        with the analytic response at the same frequencies (whole cycles in the
+        window, Goertzel as in SaturationProfiler). Points in a deep stopband
+        are skipped: there the float filters measure their own noise.
+    */
+    void checkAgainstSineMeasurement (double sampleRate)
+    {
+        constexpr int analysisLength = 8192;
+        constexpr int numTests = 3;
+        constexpr double testFrequencies[numTests] { 100.0, 1000.0, 5000.0 };
+
+        const int settleLength = juce::roundToInt (0.5 * sampleRate);  // Also outlasts a bypass crossfade
+        double aligned[numTests] {};
+        double expected[numTests] {};
+
+        for (int t = 0; t < numTests; ++t)
+        {
+            const int cycles = juce::jmax (1, juce::roundToInt (analysisLength * juce::jmin (testFrequencies[t], maxNyquistFraction * sampleRate) / sampleRate));
+            aligned[t] = cycles * sampleRate / analysisLength;
+            expected[t] = 1.0;
+        }
+
+        BiquadResponse testResponse;
+        testResponse.setFrequencies (aligned, numTests, sampleRate);
+        filters[0].multiplyMagnitudeResponse (testResponse, expected);
+        eq[0].multiplyMagnitudeResponse (testResponse, expected);
+
+        std::vector<double> signal (static_cast<size_t> (settleLength + analysisLength));
+
+        for (int t = 0; t < numTests; ++t)
+        {
+            if (expected[t] < 0.01)
+                continue;
+
+            const double phaseIncrement = juce::MathConstants<double>::twoPi * aligned[t] / sampleRate;
+
+            for (size_t i = 0; i < signal.size(); ++i)
+                signal[i] = 0.25 * std::sin (phaseIncrement * static_cast<double> (i));
+
+            filters[0].reset();
+            eq[0].reset();
+
+            for (int offset = 0; offset < static_cast<int> (signal.size()); offset += 512)
+            {
+                const int num = juce::jmin (512, static_cast<int> (signal.size()) - offset);
+                filters[0].processBlock (signal.data() + offset, num);
+                eq[0].processBlock (signal.data() + offset, num);
+            }
+
+            const double coefficient = 2.0 * std::cos (phaseIncrement);
+            double s1 = 0.0, s2 = 0.0;
+
+            for (int i = settleLength; i < settleLength + analysisLength; ++i)
+            {
+                const double s0 = signal[static_cast<size_t> (i)] + coefficient * s1 - s2;
+                s2 = s1;
+                s1 = s0;
+            }
+
+            const double measured = 2.0 * std::sqrt (juce::jmax (0.0, s1 * s1 + s2 * s2 - coefficient * s1 * s2)) / analysisLength / 0.25;
+
+            // Far below a pixel of the curve
+            jassert (std::abs (juce::Decibels::gainToDecibels (measured / expected[t], -100.0)) < 0.01);
+        }
+
+        filters[0].reset();
+        eq[0].reset();
+    }
+   #endif
+
+    //==============================================================================
+    ParameterSnapshot::Sources sources {};
+    ParameterSnapshot snapshot;
+    FilterSection filters[2];
+    EQSection eq[2];
+
+    BiquadResponse response;
+    std::array<double, numPoints> frequencies {};           // Where the points are drawn
+    std::array<double, numPoints> evaluatedFrequencies {};  // Where they are evaluated (below Nyquist)
+    std::array<double, numPoints> magnitudes[2] {};
+    bool showRightChannel = false;
+   #if JUCE_DEBUG
+    bool sineCheckPending = false;
+   #endif
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EQResponseCurve)
+};
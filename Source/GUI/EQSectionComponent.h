@@ -7,6 +7,7 @@
     - Bell 1 (frequency selector + gain)
     - Bell 2 (frequency selector + gain)
     - Treble shelf (gain only)
+    - Response curve (filters + EQ, see EQResponseCurve.h)
 
   ==============================================================================
 */
@@ -16,6 +17,7 @@
 #include <JuceHeader.h>
 #include "Colors.h"
 #include "AnalogChannelLookAndFeel.h"
+#include "EQResponseCurve.h"
 
 class EQSectionComponent : public juce::Component,
                            private juce::Slider::Listener,
@@ -24,6 +26,7 @@ class EQSectionComponent : public juce::Component,
 public:
     EQSectionComponent (juce::AudioProcessorValueTreeState& apvts)
         : apvtsRef (apvts),
+          responseCurve (apvts),
           // Initialize colored LookAndFeels with specific colors for each filter
           trebleLAF (juce::Colour (0xff87CEEB)),      // Sky blue (celeste) for Treble
           trebleFreqLAF (juce::Colour (0xff87CEEB)),  // Sky blue for Treble freq
@@ -197,6 +200,9 @@ public:
         sectionLabel.setFont (juce::FontOptions (11.0f, juce::Font::bold));
         addAndMakeVisible (sectionLabel);
 
+        // Response curve (updated from the editor's timer)
+        addAndMakeVisible (responseCurve);
+
         // Initialize frequency labels based on current parameter values
         updateFrequencyLabels();
 
@@ -217,6 +223,10 @@ public:
         bell2FreqKnob.setLookAndFeel (nullptr);
     }
 
+    //==============================================================================
+    // Response curve access (for the editor's timer)
+    EQResponseCurve& getResponseCurve() { return responseCurve; }
+
     //==============================================================================
     void buttonClicked (juce::Button* button) override
     {
@@ -286,7 +296,7 @@ public:
     {
         auto bounds = getLocalBounds().reduced (8);
         const int freqKnobSize = 35;   // Small knob for frequency
-        const int gainKnobSize = 70;   // Larger for gain adjustment
+        const int gainKnobSize = 60;   // Larger for gain adjustment
         const int bellFreqKnobSize = 45; // Bell frequency knobs (existing)
         const int spacing = 4;
         const int horizontalSpacing = 4;
@@ -295,6 +305,10 @@ public:
         sectionLabel.setBounds (bounds.removeFromTop (22));
         bounds.removeFromTop (4);
 
+        // Response curve below the label
+        responseCurve.setBounds (bounds.removeFromTop (36));
+        bounds.removeFromTop (4);
+
         // Treble (now at top) - with frequency knob on the side
         trebleLabel.setBounds (bounds.removeFromTop (14));
         auto trebleRow = bounds.removeFromTop (gainKnobSize);
@@ -432,6 +446,7 @@ private:
     juce::Label bassLabel, bell1Label, bell2Label, trebleLabel;
     juce::ToggleButton activeButton;
     juce::Label sectionLabel;
+    EQResponseCurve responseCurve;
 
     // Attachments
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> bassAttachment;
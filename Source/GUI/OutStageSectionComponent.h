@@ -5,6 +5,7 @@
     GUI component for OutStage section (120px column)
     - Algorithm selector (Clean, Hard Clip, Soft Clip)
     - Drive knob
+    - Transfer curve / harmonics at the current drive
     - GR indicator LED
 
   ==============================================================================
@@ -16,6 +17,7 @@
 #include "Colors.h"
 #include "AnalogChannelLookAndFeel.h"
 #include "LEDMeterStrip.h"
+#include "SaturationProfileDisplay.h"
 
 class OutStageSectionComponent : public juce::Component,
                                    private juce::Button::Listener,
@@ -25,7 +27,8 @@ public:
     OutStageSectionComponent (juce::AudioProcessorValueTreeState& apvts)
         : apvtsRef (apvts),
           driveLAF (juce::Colour (0xff1a1a1a)),
-          grMeter (8, LEDMeterStrip::OutStage)
+          grMeter (8, LEDMeterStrip::OutStage),
+          profileDisplay (apvts, SaturationProfiler::OutStage)
     {
         driveKnob.setLookAndFeel (&driveLAF);
 
@@ -78,6 +81,9 @@ public:
         sectionLabel.setFont (juce::FontOptions (11.0f, juce::Font::bold));
         addAndMakeVisible (sectionLabel);
 
+        // Transfer curve / harmonics (updated from the editor's timer)
+        addAndMakeVisible (profileDisplay);
+
         // Initialize state
         updateBypassState();
     }
@@ -144,13 +150,16 @@ public:
 
         // Drive knob
         driveLabel.setBounds (bounds.removeFromTop (15));
-        driveKnob.setBounds (bounds.removeFromTop (80));
+        driveKnob.setBounds (bounds.removeFromTop (64));
         bounds.removeFromTop (6);  // Reduced spacing after drive knob
 
         // GR meter (no label, more space)
         grMeter.setBounds (bounds.removeFromTop (45).reduced (5, 0));
         bounds.removeFromTop (8);  // Reduced spacing after meter
 
+        // Transfer curve / harmonics
+        profileDisplay.setBounds (bounds.removeFromTop (SaturationProfileDisplay::HEIGHT));
+
         // Active button at bottom
         activeButton.setBounds (bounds.removeFromBottom (26));
     }
@@ -159,6 +168,9 @@ public:
     // Accessor for parent to update GR meter
     LEDMeterStrip& getGRMeter() { return grMeter; }
 
+    // Accessor for parent to update the saturation profile
+    SaturationProfileDisplay& getProfileDisplay() { return profileDisplay; }
+
 private:
     //==============================================================================
     void updateBypassState()
@@ -215,5 +227,8 @@ private:
 
     DynamicColoredKnobLookAndFeel driveLAF;
 
+    // Transfer curve / harmonics (measured off the audio thread)
+    SaturationProfileDisplay profileDisplay;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OutStageSectionComponent)
 };
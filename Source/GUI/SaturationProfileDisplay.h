@@ -0,0 +1,193 @@
+/*
+  ==============================================================================
+
+    SaturationProfileDisplay.h
+    Transfer curve and harmonics of a saturation stage at its current drive
+    Measured by the shared SaturationProfiler, not taken from the live chain
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Colors.h"
+#include "../ParameterSnapshot.h"
+#include "../SaturationProfiler.h"
+
+/**
+    Left: the static transfer curve at 0dBFS (input -1 to 1 across, output
+    scaled to fit, unity line for reference). Right: the 2nd to 8th harmonics
+    relative to the fundamental - bars at 0dBFS, ticks at the quieter levels.
+
+    update() only asks the profiler when the stage's algorithm, drive or
+    precision (or the processing rate) changed, or the shown profile is still
+    missing levels. Until the first level of a new setting arrives the previous
+    profile stays up, so a drive drag doesn't flicker.
+*/
+class SaturationProfileDisplay : public juce::Component
+{
+public:
+    static constexpr int HEIGHT = 30;
+
+    SaturationProfileDisplay (juce::AudioProcessorValueTreeState& apvts, SaturationProfiler::Stage profiledStage)
+        : stage (profiledStage)
+    {
+        setInterceptsMouseClicks (false, false);
+
+        for (size_t i = 0; i < ParameterSnapshot::parameterIDs.size(); ++i)
+            sources[i] = apvts.getRawParameterValue (ParameterSnapshot::parameterIDs[i]);
+    }
+
+    //==============================================================================
+    /** Re-reads the parameters (message thread) and picks up newly measured levels. */
+    void update (double processingSampleRate)
+    {
+        snapshot.update (sources);
+
+        if (processingSampleRate <= 0.0)
+            return;
+
+        const auto fields = getStageFields();
+
+        // The console drive carries the left channel's variation offset, as in the processor
+        float driveDecibels = snapshot[fields.drive];
+        if (stage == SaturationProfiler::Console)
+            driveDecibels += snapshot.getChannelVariation (0).consoleDrive;
+
+        const auto key = SaturationProfiler::makeKey (stage, snapshot.getChoice (fields.algorithm), snapshot.getBool (P::EcoPrecision),
+                                                      driveDecibels, processingSampleRate);
+
+        if (profile != nullptr && profile->key == key && profile->isComplete())
+            return;
+
+        auto latest = profiler->requestProfile (key);
+
+        if (latest != nullptr && latest != profile)
+        {
+            profile = std::move (latest);
+            repaint();
+        }
+    }
+
+    //==============================================================================
+    void paint (juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds().toFloat();
+        auto curveArea = bounds.removeFromLeft (bounds.getHeight());
+        bounds.removeFromLeft (4.0f);
+        auto harmonicsArea = bounds;
+
+        for (auto area : { curveArea, harmonicsArea })
+        {
+            g.setColour (AnalogChannelColors::BG_DARK);
+            g.fillRoundedRectangle (area, 3.0f);
+        }
+
+        if (profile != nullptr)
+        {
+            paintTransferCurve (g, curveArea.reduced (2.0f));
+            paintHarmonics (g, harmonicsArea.reduced (3.0f, 2.0f));
+        }
+
+        g.setColour (AnalogChannelColors::BORDER_LIGHT);
+
+        for (auto area : { curveArea, harmonicsArea })
+            g.drawRoundedRectangle (area.reduced (0.5f), 3.0f, 1.0f);
+    }
+
+private:
+    //==============================================================================
+    static constexpr float harmonicsRangeDecibels = 90.0f;
+
+    using P = ParameterSnapshot;
+
+    struct StageFields
+    {
+        P::Field algorithm, drive;
+    };
+
+    StageFields getStageFields() const
+    {
+        switch (stage)
+        {
+            case SaturationProfiler::Console:  return { P::ConsoleAlgo, P::ConsoleDrive };
+            case SaturationProfiler::OutStage: return { P::OutStageAlgo, P::OutStageDrive };
+            default:                           return { P::PreInputAlgo, P::PreInputDrive };
+        }
+    }
+
+    void paintTransferCurve (juce::Graphics& g, juce::Rectangle<float> plot) const
+    {
+        const auto& curve = profile->transferCurve;
+
+        // Output range: at least +-1, more if the stage adds gain
+        float range = 1.0f;
+        for (float value : curve)
+            range = juce::jmax (range, std::abs (value));
+
+        auto toY = [&] (float value) { return juce::jmap (value, -range, range, plot.getBottom(), plot.getY()); };
+
+        g.setColour (AnalogChannelColors::BORDER_LIGHT);
+        g.drawLine (plot.getX(), toY (-1.0f), plot.getRight(), toY (1.0f), 1.0f);
+
+        juce::Path path;
+
+        for (size_t i = 0; i < curve.size(); ++i)
+        {
+            const float x = plot.getX() + plot.getWidth() * static_cast<float> (i) / static_cast<float> (curve.size() - 1);
+
+            if (i == 0)
+                path.startNewSubPath (x, toY (curve[i]));
+            else
+                path.lineTo (x, toY (curve[i]));
+        }
+
+        g.setColour (AnalogChannelColors::TEXT_HIGHLIGHT);
+        g.strokePath (path, juce::PathStrokeType (1.25f));
+    }
+
+    void paintHarmonics (juce::Graphics& g, juce::Rectangle<float> plot) const
+    {
+        const float slotWidth = plot.getWidth() / static_cast<float> (SaturationProfiler::numHarmonics);
+
+        auto toY = [&] (float decibels)
+        {
+            return juce::jmap (juce::jlimit (-harmonicsRangeDecibels, 0.0f, decibels),
+                               -harmonicsRangeDecibels, 0.0f, plot.getBottom(), plot.getY());
+        };
+
+        for (int harmonic = 0; harmonic < SaturationProfiler::numHarmonics; ++harmonic)
+        {
+            const float x = plot.getX() + slotWidth * static_cast<float> (harmonic);
+            const float barX = x + slotWidth * 0.2f;
+            const float barWidth = slotWidth * 0.6f;
+
+            // Even harmonics orange, odd ones silver
+            const bool isEven = (harmonic % 2) == 0;
+            const auto colour = isEven ? AnalogChannelColors::KNOB_INDICATOR : AnalogChannelColors::TEXT_MAIN;
+
+            if (profile->numLevelsMeasured > 0)
+            {
+                const float top = toY (profile->harmonicDecibels[0][harmonic]);
+                g.setColour (colour);
+                g.fillRect (barX, top, barWidth, plot.getBottom() - top);
+            }
+
+            g.setColour (colour.withAlpha (0.6f));
+
+            for (int level = 1; level < profile->numLevelsMeasured; ++level)
+                g.drawHorizontalLine (juce::roundToInt (toY (profile->harmonicDecibels[level][harmonic])), x, x + slotWidth);
+        }
+    }
+
+    //==============================================================================
+    const SaturationProfiler::Stage stage;
+    juce::SharedResourcePointer<SaturationProfiler> profiler;
+
+    ParameterSnapshot::Sources sources {};
+    ParameterSnapshot snapshot;
+    SaturationProfiler::ProfilePtr profile;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SaturationProfileDisplay)
+};
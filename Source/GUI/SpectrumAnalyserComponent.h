@@ -0,0 +1,228 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyserComponent.h
+    Pre/post spectrum display (20Hz - 20kHz, log frequency)
+    Input is drawn as a dim fill, output as an orange line
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Colors.h"
+#include "../SpectrumAnalyser.h"
+
+class SpectrumAnalyserComponent : public juce::Component,
+                                  private juce::Timer
+{
+public:
+    static constexpr int HEIGHT = 110;
+
+    explicit SpectrumAnalyserComponent (SpectrumAnalyser& analyserToShow)
+        : analyser (analyserToShow)
+    {
+        setInterceptsMouseClicks (false, false);
+        setOpaque (true);
+    }
+
+    ~SpectrumAnalyserComponent() override
+    {
+        stopTimer();
+        analyser.setActive (false);
+    }
+
+    //==============================================================================
+    void paint (juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds().toFloat();
+        auto plot = bounds.reduced (2.0f);
+
+        // Background
+        g.fillAll (AnalogChannelColors::BG_DARK);
+        g.setColour (AnalogChannelColors::PANEL_BG);
+        g.fillRoundedRectangle (plot, 3.0f);
+
+        // Grid: decades / octave-ish frequencies and 12dB steps
+        g.setFont (juce::FontOptions (8.0f));
+
+        for (float freq : { 50.0f, 100.0f, 200.0f, 500.0f, 1000.0f, 2000.0f, 5000.0f, 10000.0f })
+        {
+            const float x = plot.getX() + frequencyToProportion (freq) * plot.getWidth();
+            g.setColour (AnalogChannelColors::BORDER_LIGHT);
+            g.drawVerticalLine (juce::roundToInt (x), plot.getY(), plot.getBottom());
+
+            g.setColour (AnalogChannelColors::TEXT_DIM);
+            const juce::String label = freq >= 1000.0f ? juce::String (freq / 1000.0f) + "k" : juce::String (juce::roundToInt (freq));
+            g.drawText (label, juce::Rectangle<float> (x + 2.0f, plot.getBottom() - 11.0f, 30.0f, 10.0f),
+                        juce::Justification::centredLeft);
+        }
+
+        for (float db = -12.0f; db > minDisplayDecibels; db -= 12.0f)
+        {
+            const float y = decibelsToY (db, plot);
+            g.setColour (AnalogChannelColors::BORDER_LIGHT);
+            g.drawHorizontalLine (juce::roundToInt (y), plot.getX(), plot.getRight());
+
+            g.setColour (AnalogChannelColors::TEXT_DIM);
+            g.drawText (juce::String (juce::roundToInt (db)), juce::Rectangle<float> (plot.getX() + 2.0f, y - 10.0f, 24.0f, 10.0f),
+                        juce::Justification::centredLeft);
+        }
+
+        if (hasData)
+        {
+            // Input: filled, dim
+            auto inputPath = createCurve (columns[SpectrumAnalyser::Input], plot);
+            inputPath.lineTo (plot.getRight(), plot.getBottom());
+            inputPath.lineTo (plot.getX(), plot.getBottom());
+            inputPath.closeSubPath();
+            g.setColour (AnalogChannelColors::TEXT_DIM.withAlpha (0.35f));
+            g.fillPath (inputPath);
+
+            // Output: orange line
+            g.setColour (AnalogChannelColors::KNOB_INDICATOR);
+            g.strokePath (createCurve (columns[SpectrumAnalyser::Output], plot), juce::PathStrokeType (1.2f));
+        }
+
+        // Legend
+        g.setFont (juce::FontOptions (9.0f));
+        auto legend = plot.reduced (6.0f, 3.0f).removeFromTop (11.0f);
+        g.setColour (AnalogChannelColors::KNOB_INDICATOR);
+        g.drawText ("OUT", legend.removeFromRight (24.0f), juce::Justification::centredRight);
+        g.setColour (AnalogChannelColors::TEXT_DIM);
+        g.drawText ("IN", legend.removeFromRight (24.0f), juce::Justification::centredRight);
+
+        // Border
+        g.setColour (AnalogChannelColors::BORDER_LIGHT);
+        g.drawRoundedRectangle (plot, 3.0f, 1.0f);
+    }
+
+    void resized() override
+    {
+        // One value per pixel column of the plot
+        const int numColumns = juce::jmax (2, getWidth() - 4);
+
+        for (auto& tapColumns : columns)
+            tapColumns.assign (static_cast<size_t> (numColumns), minDisplayDecibels);
+
+        lastFrameSeen = 0;  // Recompute the columns for the new width
+    }
+
+    void visibilityChanged() override
+    {
+        // The analyser (and its thread) only runs while this is visible
+        analyser.setActive (isVisible());
+
+        if (isVisible())
+            startTimerHz (SpectrumAnalyser::frameRateHz);
+        else
+            stopTimer();
+    }
+
+private:
+    //==============================================================================
+    static constexpr float minFrequency = 20.0f;
+    static constexpr float maxFrequency = 20000.0f;
+    static constexpr float minDisplayDecibels = -90.0f;
+
+    void timerCallback() override
+    {
+        const double sampleRate = analyser.getSampleRate();
+        const uint32_t previousFrameSeen = lastFrameSeen;
+
+        for (int tap = 0; tap < SpectrumAnalyser::NumTaps; ++tap)
+        {
+            uint32_t frameSeen = previousFrameSeen;
+
+            if (analyser.copyFrame (static_cast<SpectrumAnalyser::Tap> (tap), frame, frameSeen))
+            {
+                updateColumns (columns[tap], sampleRate);
+                lastFrameSeen = frameSeen;
+            }
+        }
+
+        if (lastFrameSeen != previousFrameSeen)
+        {
+            hasData = true;
+            repaint();
+        }
+    }
+
+    // Frame bins -> pixel columns: the loudest bin within a column, or the
+    // interpolated level where one bin spans several columns (low end)
+    void updateColumns (std::vector<float>& tapColumns, double sampleRate)
+    {
+        const int numColumns = static_cast<int> (tapColumns.size());
+        const double binsPerHz = SpectrumAnalyser::fftSize / sampleRate;
+        const int lastBin = SpectrumAnalyser::numBins - 1;
+
+        auto columnToBin = [&] (double column)
+        {
+            const double proportion = column / static_cast<double> (numColumns - 1);
+            return minFrequency * std::pow (maxFrequency / minFrequency, proportion) * binsPerHz;
+        };
+
+        for (int column = 0; column < numColumns; ++column)
+        {
+            const double binStart = columnToBin (column - 0.5);
+            const double binEnd = columnToBin (column + 0.5);
+            float level = minDisplayDecibels;
+
+            if (binEnd - binStart < 1.0)
+            {
+                const double bin = juce::jlimit (0.0, static_cast<double> (lastBin), 0.5 * (binStart + binEnd));
+                const int index = juce::jmin (static_cast<int> (bin), lastBin - 1);
+                const float fraction = static_cast<float> (bin - index);
+                level = juce::jmap (fraction, frame[static_cast<size_t> (index)], frame[static_cast<size_t> (index + 1)]);
+            }
+            else
+            {
+                const int first = juce::jlimit (0, lastBin, static_cast<int> (std::ceil (binStart)));
+                const int last = juce::jlimit (0, lastBin, static_cast<int> (binEnd));
+
+                for (int bin = first; bin <= last; ++bin)
+                    level = juce::jmax (level, frame[static_cast<size_t> (bin)]);
+            }
+
+            tapColumns[static_cast<size_t> (column)] = juce::jmax (level, minDisplayDecibels);
+        }
+    }
+
+    juce::Path createCurve (const std::vector<float>& tapColumns, juce::Rectangle<float> plot) const
+    {
+        juce::Path path;
+
+        for (size_t column = 0; column < tapColumns.size(); ++column)
+        {
+            const float x = plot.getX() + static_cast<float> (column);
+            const float y = decibelsToY (tapColumns[column], plot);
+
+            if (column == 0)
+                path.startNewSubPath (x, y);
+            else
+                path.lineTo (x, y);
+        }
+
+        return path;
+    }
+
+    static float frequencyToProportion (float frequency)
+    {
+        return std::log (frequency / minFrequency) / std::log (maxFrequency / minFrequency);
+    }
+
+    static float decibelsToY (float decibels, juce::Rectangle<float> plot)
+    {
+        return juce::jmap (decibels, minDisplayDecibels, 0.0f, plot.getBottom(), plot.getY());
+    }
+
+    //==============================================================================
+    SpectrumAnalyser& analyser;
+    SpectrumAnalyser::Frame frame {};
+    std::vector<float> columns[SpectrumAnalyser::NumTaps];
+    uint32_t lastFrameSeen = 0;
+    bool hasData = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyserComponent)
+};
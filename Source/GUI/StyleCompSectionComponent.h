@@ -4,6 +4,7 @@
     StyleCompSectionComponent.h
     GUI component for Style-Comp section (140px column)
     - Mode selector (Warm / Punch)
+    - Stereo link selector (Off / Max / Sum)
     - Comp IN knob (drive)
     - Makeup knob (smaller)
     - GR LED meter strip
@@ -38,6 +39,16 @@ public:
         modeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment> (
             apvts, "styleCompAlgo", modeCombo);
 
+        // Stereo link selector
+        // Parameter order: { "Off", "Max", "Sum" }
+        linkCombo.addItem ("Link Off", 1);
+        linkCombo.addItem ("Link Max", 2);
+        linkCombo.addItem ("Link Sum", 3);
+        addAndMakeVisible (linkCombo);
+
+        linkAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment> (
+            apvts, "styleCompLink", linkCombo);
+
         updateKnobColor();
 
         // Comp IN knob
@@ -208,8 +219,11 @@ public:
         sectionLabel.setBounds (bounds.removeFromTop (25));
         bounds.removeFromTop (5);
 
-        // Mode selector
-        modeCombo.setBounds (bounds.removeFromTop (25));
+        // Mode and stereo link selectors, side by side
+        auto selectorArea = bounds.removeFromTop (25);
+        modeCombo.setBounds (selectorArea.removeFromLeft (selectorArea.getWidth() / 2 - 2));
+        selectorArea.removeFromLeft (4);
+        linkCombo.setBounds (selectorArea);
         bounds.removeFromTop (10);
 
         // Comp IN knob (large)
@@ -267,6 +281,7 @@ private:
 
         // Enable/disable controls
         modeCombo.setEnabled (isActive);
+        linkCombo.setEnabled (isActive);
         compInKnob.setEnabled (isActive);
         makeupKnob.setEnabled (isActive);
         mixKnob.setEnabled (isActive);
@@ -300,6 +315,7 @@ private:
     juce::AudioProcessorValueTreeState& apvtsRef;
 
     juce::ComboBox modeCombo;
+    juce::ComboBox linkCombo;
     juce::Slider compInKnob;
     juce::Slider makeupKnob;
     juce::Slider mixKnob;
@@ -312,6 +328,7 @@ private:
     juce::Label sectionLabel;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> modeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> linkAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> compInAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> makeupAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> mixAttachment;
@@ -0,0 +1,166 @@
+/*
+  ==============================================================================
+
+    ParameterEventQueue.h
+    Parameter changes pushed to the audio thread as events
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    One APVTS listener per snapshot field pushes (field, value) into a ring
+    buffer; the audio thread drains it at block start into the
+    ParameterSnapshot. Change handling is O(changes) instead of a pass over
+    every parameter atomic, which matters at small buffer sizes where the
+    per-block overhead dominates.
+
+    APVTS listeners run on whichever thread set the parameter (GUI, host
+    automation - possibly the audio thread itself -, state restore), so
+    there can be several producers. The ring itself is single-producer /
+    single-consumer; producers take a try-lock and never wait. A push that
+    finds the lock taken or the ring full sets a resync flag instead, and
+    the audio thread re-reads every field once (ParameterSnapshot::update()).
+    No thread ever blocks, and no change is lost: the APVTS atomic already
+    holds the new value when the listener runs.
+
+    Events carry no sample offset: APVTS listeners don't know one, so
+    changes take effect at the start of the next block (as before).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include "ParameterSnapshot.h"
+
+//==============================================================================
+/**
+    Forwards changes of the ParameterSnapshot fields to the audio thread.
+
+    Scope: listeners are registered for ParameterSnapshot::parameterIDs only,
+    which covers every parameter in the layout except hostBypass. That one is
+    the host's bypass parameter (getBypassParameter()) and processBlock()
+    reads it directly each block; it never goes through the queue. A new
+    parameter the chain reads needs a snapshot field to be seen here.
+
+    Producers never wait: push() takes a try-lock, and if another thread
+    holds it (or the ring is full) the event is dropped and a full resync is
+    requested instead - drainInto() then re-reads every field from the APVTS
+    atomics, so the value still arrives by the next block.
+*/
+class ParameterEventQueue
+{
+public:
+    /** Ring size in events; a full ring falls back to a resync, never blocks. */
+    static constexpr uint32_t capacity = 256;
+
+    ParameterEventQueue()
+    {
+        for (int i = 0; i < ParameterSnapshot::NumFields; ++i)
+        {
+            forwarders[static_cast<std::size_t> (i)].queue = this;
+            forwarders[static_cast<std::size_t> (i)].field = static_cast<ParameterSnapshot::Field> (i);
+        }
+    }
+
+    //==============================================================================
+    /** Registers one listener per snapshot field (message thread). */
+    void attachTo (juce::AudioProcessorValueTreeState& state)
+    {
+        for (auto& forwarder : forwarders)
+            state.addParameterListener (ParameterSnapshot::parameterIDs[static_cast<std::size_t> (forwarder.field)], &forwarder);
+    }
+
+    void detachFrom (juce::AudioProcessorValueTreeState& state)
+    {
+        for (auto& forwarder : forwarders)
+            state.removeParameterListener (ParameterSnapshot::parameterIDs[static_cast<std::size_t> (forwarder.field)], &forwarder);
+    }
+
+    //==============================================================================
+    /** Any thread, wait-free. */
+    void push (ParameterSnapshot::Field field, float value)
+    {
+        const juce::SpinLock::ScopedTryLockType lock (producerLock);
+
+        if (! lock.isLocked())
+        {
+            requestResync();  // Another thread is pushing right now
+            return;
+        }
+
+        const uint32_t write = writeIndex.load (std::memory_order_relaxed);
+
+        if (write - readIndex.load (std::memory_order_acquire) >= capacity)
+        {
+            requestResync();
+            return;
+        }
+
+        events[write % capacity] = { field, value };
+        writeIndex.store (write + 1, std::memory_order_release);
+    }
+
+    /** Any thread: the consumer re-reads every field on its next drain. */
+    void requestResync()
+    {
+        resyncNeeded.store (true, std::memory_order_release);
+    }
+
+    //==============================================================================
+    /**
+        Audio thread: applies the pending events to the snapshot (marking the
+        fields whose value actually changed), or re-reads all sources after a
+        dropped event.
+    */
+    void drainInto (ParameterSnapshot& snapshot, const ParameterSnapshot::Sources& sources)
+    {
+        const bool resync = resyncNeeded.exchange (false, std::memory_order_acquire);
+        const uint32_t write = writeIndex.load (std::memory_order_acquire);
+        uint32_t read = readIndex.load (std::memory_order_relaxed);
+
+        if (! resync)
+        {
+            for (; read != write; ++read)
+                snapshot.set (events[read % capacity].field, events[read % capacity].value);
+        }
+
+        readIndex.store (write, std::memory_order_release);
+
+        // Events queued from here on are re-applied next block (no-ops if unchanged)
+        if (resync)
+            snapshot.update (sources);
+    }
+
+private:
+    //==============================================================================
+    struct Event
+    {
+        ParameterSnapshot::Field field;
+        float value;
+    };
+
+    struct Forwarder : public juce::AudioProcessorValueTreeState::Listener
+    {
+        void parameterChanged (const juce::String&, float newValue) override
+        {
+            queue->push (field, newValue);
+        }
+
+        ParameterEventQueue* queue = nullptr;
+        ParameterSnapshot::Field field = ParameterSnapshot::Field (0);
+    };
+
+    std::array<Event, capacity> events {};
+    std::atomic<uint32_t> writeIndex { 0 };
+    std::atomic<uint32_t> readIndex { 0 };
+    std::atomic<bool> resyncNeeded { true };  // The first drain reads every field
+    juce::SpinLock producerLock;
+
+    std::array<Forwarder, ParameterSnapshot::NumFields> forwarders;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterEventQueue)
+};
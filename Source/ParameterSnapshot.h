@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    ParameterSnapshot.h
+    Per-block parameter values for the processing sections
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    The processor keeps every parameter the sections consume in a flat array
+    of floats plus a bitmask of the fields that changed since the previous
+    block. Changes arrive as events (ParameterEventQueue.h); a full pass over
+    the cached APVTS atomics (update()) is the fallback. Each section then takes its
+    fields from the snapshot (applyParameters()) and only re-runs its heavy
+    setters (compressor parameters, filter coefficients) when one of them
+    changed.
+
+    The sections don't know about the APVTS: anything that can fill a
+    snapshot (an offline renderer, a test) can drive them.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include "ChannelVariation.h"
+
+//==============================================================================
+struct ParameterSnapshot
+{
+    /** One entry per parameter the chain consumes (order of the signal chain, then the processing options). */
+    enum Field
+    {
+        PreInputAlgo, PreInputDrive, PreInputBypass,
+        HpfFreq, HpfSlope, HpfQ, LpfFreq, LpfSlope, LpfQ, FiltersBypass, FiltersPost,
+        CtrlCompThresh, CtrlCompAR, CtrlCompBypass, CtrlCompLink,
+        LowDynThresh, LowDynRatio, LowDynFast, LowDynMix, LowDynBypass,
+        EqBass, EqBassFreq, EqTreble, EqTrebleFreq,
+        EqBell1Freq, EqBell1Gain, EqBell2Freq, EqBell2Gain, EqBypass,
+        StyleCompAlgo, StyleCompIn, StyleCompMakeup, StyleCompMix, StyleCompBypass, StyleCompPreEQ, StyleCompLink,
+        ConsoleAlgo, ConsoleDrive, ConsoleBypass,
+        OutStageAlgo, OutStageDrive, OutStageBypass,
+        OutputGain, VolumeBypass,
+        ChannelVariationMode, ChannelPair,
+        EcoPrecision, EcoMode, Multicore, DetectorsWhileBypassed,
+        NumFields
+    };
+
+    static_assert (NumFields <= 64, "The changed mask holds one bit per field");
+
+    /** Parameter IDs (APVTS) of the fields, in Field order. */
+    static constexpr std::array<const char*, NumFields> parameterIDs {{
+        "preInputAlgo", "preInputDrive", "preInputBypass",
+        "hpfFreq", "hpfSlope", "hpfQ", "lpfFreq", "lpfSlope", "lpfQ", "filtersBypass", "filtersPost",
+        "ctrlCompThresh", "ctrlCompAR", "ctrlCompBypass", "ctrlCompLink",
+        "lowDynThresh", "lowDynRatio", "lowDynFast", "lowDynMix", "lowDynBypass",
+        "eqBass", "eqBassFreq", "eqTreble", "eqTrebleFreq",
+        "eqBell1Freq", "eqBell1Gain", "eqBell2Freq", "eqBell2Gain", "eqBypass",
+        "styleCompAlgo", "styleCompIn", "styleCompMakeup", "styleCompMix", "styleCompBypass", "styleCompPreEQ", "styleCompLink",
+        "consoleAlgo", "consoleDrive", "consoleBypass",
+        "outStageAlgo", "outStageDrive", "outStageBypass",
+        "outputGain", "volumeBypass",
+        "channelVariationMode", "channelPair",
+        "ecoPrecision", "ecoMode", "multicore", "detectorsWhileBypassed"
+    }};
+
+    using Sources = std::array<const std::atomic<float>*, NumFields>;
+
+    //==============================================================================
+    static constexpr uint64_t allFields = ~uint64_t (0);
+
+    template <typename... Fields>
+    static constexpr uint64_t mask (Fields... fields)
+    {
+        return ((uint64_t (1) << fields) | ...);
+    }
+
+    /** Fields that select the channel variation preset (every offset depends on them). */
+    static constexpr uint64_t channelVariationFields = (uint64_t (1) << ChannelVariationMode) | (uint64_t (1) << ChannelPair);
+
+    //==============================================================================
+    float operator[] (Field field) const { return values[field]; }
+    bool getBool (Field field) const { return values[field] > 0.5f; }
+    int getChoice (Field field) const { return static_cast<int> (values[field]); }
+
+    /** True if any field in the mask changed since the previous snapshot. */
+    bool hasChanged (uint64_t fieldMask) const { return (changed & fieldMask) != 0; }
+
+    /** The next consumer re-applies every field (after prepareToPlay, on state restore). */
+    void markAllChanged() { changed = allFields; }
+
+    /**
+        Reads all sources (one pass, relaxed loads) and records which fields
+        differ from the previous snapshot. Missing sources keep their value.
+        Changes accumulate until the consumer calls clearChanges().
+    */
+    void update (const Sources& sources)
+    {
+        for (int i = 0; i < NumFields; ++i)
+        {
+            if (sources[i] == nullptr)
+                continue;
+
+            set (static_cast<Field> (i), sources[i]->load (std::memory_order_relaxed));
+        }
+    }
+
+    /** Sets one field, marking it changed if the value differs (ParameterEventQueue). */
+    void set (Field field, float value)
+    {
+        if (value != values[field])
+        {
+            values[field] = value;
+            changed |= uint64_t (1) << field;
+        }
+    }
+
+    void clearChanges() { changed = 0; }
+
+    //==============================================================================
+    /**
+        Channel variation offsets for a channel (0 = left, 1 = right), neutral
+        when variation is Off. Stereo mode uses the pair's own preset per
+        channel, Mono mode the pair's left preset on both.
+    */
+    ChannelVariationPreset getChannelVariation (int channel) const
+    {
+        const int mode = getChoice (ChannelVariationMode);
+        const int pair = getChoice (ChannelPair);
+        int variationIndex = -1;  // -1 = no variation (Off mode)
+
+        if (mode == 1)       // Stereo mode (L≠R)
+            variationIndex = pair * 2 + channel;
+        else if (mode == 2)  // Mono mode (L=R, both use left channel preset)
+            variationIndex = pair * 2;
+
+        if (variationIndex >= 0 && variationIndex < ChannelVariations::MAX_CHANNELS)
+            return ChannelVariations::allPresets[static_cast<std::size_t> (variationIndex)];
+
+        return {};  // Neutral preset (all zeros)
+    }
+
+    //==============================================================================
+    float values[NumFields] {};
+    uint64_t changed = allFields;
+};
@@ -38,7 +38,8 @@ AnalogChannelAudioProcessorEditor::AnalogChannelAudioProcessorEditor (AnalogChan
       consoleSection (p.getValueTreeState()),
       outStageSection (p.getValueTreeState()),
       analogChannelsSection (p.getValueTreeState()),
-      volumeSection (p.getValueTreeState())
+      volumeSection (p.getValueTreeState()),
+      spectrumAnalyserView (p.getSpectrumAnalyser())
 {
     // Set custom Look & Feel
     setLookAndFeel (&AnalogChannelLAF);
@@ -80,6 +81,10 @@ AnalogChannelAudioProcessorEditor::AnalogChannelAudioProcessorEditor (AnalogChan
     addAndMakeVisible (analogChannelsSection);
     addAndMakeVisible (volumeSection);
 
+    // Spectrum analyser: hidden (and idle) unless enabled from the menu
+    addChildComponent (spectrumAnalyserView);
+    spectrumAnalyserView.setVisible (audioProcessor.getShowAnalyser());
+
     // Load logo image for About dialog
     bannerLogoImage = juce::ImageCache::getFromMemory (BinaryData::logo_banner_png, BinaryData::logo_banner_pngSize);
 
@@ -92,9 +97,7 @@ AnalogChannelAudioProcessorEditor::AnalogChannelAudioProcessorEditor (AnalogChan
     currentZoomScale = savedZoomScale;
 
     // Set initial size at default scale (will be adjusted in parentHierarchyChanged)
-    const int baseWidth = 710;
-    const int baseHeight = 624;
-    setSize (baseWidth, baseHeight);
+    setSize (baseWidth, getBaseHeight());
 
     // Start timer for meter updates (30 Hz)
     startTimerHz (30);
@@ -131,6 +134,13 @@ void AnalogChannelAudioProcessorEditor::resized()
     // Preset bar at bottom (40px height)
     presetBar.setBounds (bounds.removeFromBottom (40));
 
+    // Spectrum analyser above the preset bar (full width)
+    if (spectrumAnalyserView.isVisible())
+    {
+        spectrumAnalyserView.setBounds (bounds.removeFromBottom (SpectrumAnalyserComponent::HEIGHT));
+        bounds.removeFromBottom (4);  // Spacing
+    }
+
     // Main area
     auto mainArea = bounds;
 
@@ -205,6 +215,14 @@ void AnalogChannelAudioProcessorEditor::timerCallback()
     controlCompSection.getGRMeter().setValue (std::abs (audioProcessor.getControlCompGRLeft()));
     styleCompSection.getGRMeter().setValue (std::abs (audioProcessor.getStyleCompGRLeft()));
     outStageSection.getGRMeter().setValue (std::abs (audioProcessor.getOutStageGRLeft()));
+
+    // EQ response curve (recomputed only when a filter/EQ parameter changed)
+    eqSection.getResponseCurve().update (audioProcessor.getProcessingSampleRate());
+
+    // Saturation profiles (measured in the background, cached per drive)
+    preInputSection.getProfileDisplay().update (audioProcessor.getProcessingSampleRate());
+    consoleSection.getProfileDisplay().update (audioProcessor.getProcessingSampleRate());
+    outStageSection.getProfileDisplay().update (audioProcessor.getProcessingSampleRate());
 }
 
 void AnalogChannelAudioProcessorEditor::populateMenu (juce::PopupMenu& menu)
@@ -228,6 +246,17 @@ void AnalogChannelAudioProcessorEditor::populateMenu (juce::PopupMenu& menu)
     sizeMenu.addItem (13, "150%", true, currentZoomScale == 1.5f);
 
     menu.addSubMenu ("Plugin Size", sizeMenu);
+
+    // Spectrum analyser (input / output)
+    menu.addItem (20, "Spectrum Analyser", true, spectrumAnalyserView.isVisible());
+
+    // Processing options submenu
+    juce::PopupMenu processingMenu;
+    processingMenu.addItem (30, "Eco Mode (base rate in 2x/4x sessions)", true, isOptionEnabled ("ecoMode"));
+    processingMenu.addItem (31, "Eco Precision (float algorithms)", true, isOptionEnabled ("ecoPrecision"));
+    processingMenu.addItem (32, "Multicore (L/R on two threads)", true, isOptionEnabled ("multicore"));
+
+    menu.addSubMenu ("Processing", processingMenu);
 }
 
 void AnalogChannelAudioProcessorEditor::handleMenuResult (int result)
@@ -387,6 +416,22 @@ void AnalogChannelAudioProcessorEditor::handleMenuResult (int result)
             applyZoomScale (1.5f);
             break;
 
+        case 20:  // Spectrum Analyser
+            setAnalyserShown (! spectrumAnalyserView.isVisible());
+            break;
+
+        case 30:  // Eco Mode
+            toggleOption ("ecoMode");
+            break;
+
+        case 31:  // Eco Precision
+            toggleOption ("ecoPrecision");
+            break;
+
+        case 32:  // Multicore
+            toggleOption ("multicore");
+            break;
+
         default:
             break;
     }
@@ -396,10 +441,6 @@ void AnalogChannelAudioProcessorEditor::applyZoomScale (float scale)
 {
     currentZoomScale = scale;
 
-    // Base size: 710x624 (original 580 + 40 preset bar + 4 padding)
-    const int baseWidth = 710;
-    const int baseHeight = 624;
-
     // IMPORTANT: We use setScaleFactor() which handles both:
     // 1. Scaling the component hierarchy
     // 2. Adjusting the window size automatically
@@ -409,7 +450,7 @@ void AnalogChannelAudioProcessorEditor::applyZoomScale (float scale)
     setTransform (juce::AffineTransform());
 
     // Set the base size (unscaled)
-    setSize (baseWidth, baseHeight);
+    setSize (baseWidth, getBaseHeight());
 
     // Apply the scale factor (JUCE handles everything)
     setScaleFactor (scale);
@@ -438,14 +479,45 @@ void AnalogChannelAudioProcessorEditor::parentHierarchyChanged()
             {
                 if (auto* editor = this)
                 {
-                    const int baseWidth = 710;
-                    const int baseHeight = 624;
-
                     editor->setTransform (juce::AffineTransform());
-                    editor->setSize (baseWidth, baseHeight);
+                    editor->setSize (baseWidth, editor->getBaseHeight());
                     editor->setScaleFactor (savedZoomScale);
                 }
             });
         }
     }
 }
+
+int AnalogChannelAudioProcessorEditor::getBaseHeight() const
+{
+    return 624 + (spectrumAnalyserView.isVisible() ? SpectrumAnalyserComponent::HEIGHT + 4 : 0);
+}
+
+void AnalogChannelAudioProcessorEditor::setAnalyserShown (bool shouldShow)
+{
+    // Showing it starts the analysis; hiding it stops the thread again
+    spectrumAnalyserView.setVisible (shouldShow);
+    audioProcessor.setShowAnalyser (shouldShow);
+
+    // Unscaled size; the current zoom factor stays applied
+    setSize (baseWidth, getBaseHeight());
+}
+
+bool AnalogChannelAudioProcessorEditor::isOptionEnabled (const juce::String& parameterID) const
+{
+    if (auto* parameter = audioProcessor.getValueTreeState().getParameter (parameterID))
+        return parameter->getValue() > 0.5f;
+
+    return false;
+}
+
+void AnalogChannelAudioProcessorEditor::toggleOption (const juce::String& parameterID)
+{
+    // The processor picks the change up through its parameter listener
+    if (auto* parameter = audioProcessor.getValueTreeState().getParameter (parameterID))
+    {
+        parameter->beginChangeGesture();
+        parameter->setValueNotifyingHost (parameter->getValue() > 0.5f ? 0.0f : 1.0f);
+        parameter->endChangeGesture();
+    }
+}
@@ -39,6 +39,7 @@
 #include "GUI/ConsoleSectionComponent.h"
 #include "GUI/AnalogChannelsSectionComponent.h"
 #include "GUI/VolumeSectionComponent.h"
+#include "GUI/SpectrumAnalyserComponent.h"
 #include "GUI/Common/PluginHeaderBar.h"
 #include "GUI/Common/PresetBarComponent.h"
 
@@ -73,6 +74,17 @@ private:
     // Apply zoom scale to plugin window
     void applyZoomScale (float scale);
 
+    // Unscaled editor size: 710x624 (original 580 + 40 preset bar + 4 padding),
+    // taller while the spectrum analyser is shown
+    static constexpr int baseWidth = 710;
+    int getBaseHeight() const;
+
+    void setAnalyserShown (bool shouldShow);
+
+    // Processing options (non-automatable bool parameters, toggled from the menu)
+    bool isOptionEnabled (const juce::String& parameterID) const;
+    void toggleOption (const juce::String& parameterID);
+
     //==============================================================================
     // Processor reference
     AnalogChannelAudioProcessor& audioProcessor;
@@ -102,6 +114,9 @@ private:
     AnalogChannelsSectionComponent analogChannelsSection;
     VolumeSectionComponent volumeSection;
 
+    // Spectrum analyser (optional, above the preset bar)
+    SpectrumAnalyserComponent spectrumAnalyserView;
+
     // Logo image for About dialog
     juce::Image bannerLogoImage;
 
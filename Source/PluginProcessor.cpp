@@ -46,27 +46,52 @@ AnalogChannelAudioProcessor::AnalogChannelAudioProcessor()
 #endif
        parameters (*this, nullptr, juce::Identifier ("AnalogChannel"), createParameterLayout())
 {
-    // Initialize GUI settings (global preferences, not per-project)
+    // GUI settings options (global preferences, not per-project)
+    // NOTE: The PropertiesFile itself is created lazily in getGuiSettings() on first
+    // editor access - hosts instantiate the plugin on every scan and session load,
+    // and a disk read here would be paid by every instance.
     guiSettingsOptions.applicationName = "AnalogChannel";
     guiSettingsOptions.filenameSuffix = ".settings";
     guiSettingsOptions.folderName = "KuramaSound";
     guiSettingsOptions.osxLibrarySubFolder = "Application Support";
 
-    guiSettings = std::make_unique<juce::PropertiesFile> (guiSettingsOptions);
+    // NOTE: Migration from old APVTS guiZoom parameter happens in setStateInformation()
+    // when loading old projects that still have guiZoom in their saved state
+
+    hostBypass = dynamic_cast<juce::AudioParameterBool*> (parameters.getParameter ("hostBypass"));
+    jassert (hostBypass != nullptr);
 
-    // Set default guiZoom if not already set (first time user)
-    if (!guiSettings->containsKey ("guiZoom"))
+    // Per-block parameter snapshot sources (see ParameterSnapshot.h)
+    for (int i = 0; i < ParameterSnapshot::NumFields; ++i)
     {
-        guiSettings->setValue ("guiZoom", 2); // Default: 125% (index 2)
-        guiSettings->saveIfNeeded();
+        parameterSources[static_cast<std::size_t> (i)] = parameters.getRawParameterValue (ParameterSnapshot::parameterIDs[static_cast<std::size_t> (i)]);
+        jassert (parameterSources[static_cast<std::size_t> (i)] != nullptr);
     }
 
-    // NOTE: Migration from old APVTS guiZoom parameter happens in setStateInformation()
-    // when loading old projects that still have guiZoom in their saved state
+    parameterEvents.attachTo (parameters);
+
+    // Algorithm selectors drive the lazy allocation of algorithm state
+    for (auto* id : { "preInputAlgo", "styleCompAlgo", "consoleAlgo", "outStageAlgo" })
+        parameters.addParameterListener (id, this);
+
+    // Eco mode changes the processing rate (re-prepared on the message thread),
+    // eco precision swaps the algorithm state for the float variants
+    parameters.addParameterListener ("ecoMode", this);
+    parameters.addParameterListener ("ecoPrecision", this);
+    parameters.addParameterListener ("multicore", this);
 }
 
 AnalogChannelAudioProcessor::~AnalogChannelAudioProcessor()
 {
+    for (auto* id : { "preInputAlgo", "styleCompAlgo", "consoleAlgo", "outStageAlgo" })
+        parameters.removeParameterListener (id, this);
+
+    parameters.removeParameterListener ("ecoMode", this);
+    parameters.removeParameterListener ("ecoPrecision", this);
+    parameters.removeParameterListener ("multicore", this);
+    parameterEvents.detachFrom (parameters);
+
+    cancelPendingUpdate();
 }
 
 //==============================================================================
@@ -137,7 +162,38 @@ void AnalogChannelAudioProcessor::changeProgramName (int index, const juce::Stri
 //==============================================================================
 void AnalogChannelAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    juce::ignoreUnused (samplesPerBlock);
+    ecoMaxBlockSize = juce::jmax (1, samplesPerBlock);
+    maxBlockSize = ecoMaxBlockSize;
+    spectrumAnalyser.setSampleRate (sampleRate);
+
+    // Host bypass crossfade (10ms), dry copies allocated here - never on the audio thread.
+    // Both precisions: a host may switch without preparing again
+    hostBypassFadeSamples = juce::jmax (1, static_cast<int> (0.01 * sampleRate));
+    std::get<juce::AudioBuffer<float>> (hostBypassDryBuffers).setSize (2, hostBypassFadeSamples);
+    std::get<juce::AudioBuffer<double>> (hostBypassDryBuffers).setSize (2, hostBypassFadeSamples);
+    hostBypassWetPosition = (hostBypass != nullptr && hostBypass->get()) ? 0 : hostBypassFadeSamples;
+
+    // Worker threads (re)started while the audio thread is stopped
+    prepareWorkerPool (sampleRate, samplesPerBlock);
+
+    // Eco mode: the sections run at the reduced processing rate
+    prepareProcessingRate (sampleRate, isEcoModeRequested() ? getEcoResamplingFactor (sampleRate) : 1);
+}
+
+void AnalogChannelAudioProcessor::prepareProcessingRate (double sampleRate, int newEcoFactor)
+{
+    ecoFactor = newEcoFactor;
+    const double processingRate = sampleRate / static_cast<double> (ecoFactor);
+    processingSampleRate.store (processingRate);
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        ecoResamplers[ch].prepare (ecoFactor, ecoMaxBlockSize);
+        dryDelays[ch].prepare (ecoResamplers[ch].getLatencySamples());
+    }
+
+    prepareScratchArena();
+    setLatencySamples (ecoResamplers[0].getLatencySamples());
 
     // Initialize all sections with sample rate (dual-mono: left and right)
     for (int ch = 0; ch < 2; ++ch)
@@ -145,37 +201,153 @@ void AnalogChannelAudioProcessor::prepareToPlay (double sampleRate, int samplesP
         // Set channel index for PRNG seed initialization (L/R independent random sequences)
         preInput[ch].setChannelIndex (ch);
 
-        preInput[ch].setSampleRate (sampleRate);
-        filters[ch].setSampleRate (sampleRate);
-        controlComp[ch].setSampleRate (sampleRate);
-        lowDynamic[ch].setSampleRate (sampleRate);
-        eq[ch].setSampleRate (sampleRate);
-        styleComp[ch].setSampleRate (sampleRate);
-        console[ch].setSampleRate (sampleRate);
-        outStage[ch].setSampleRate (sampleRate);
-        volume[ch].setSampleRate (sampleRate);
+        preInput[ch].setSampleRate (processingRate);
+        filters[ch].setSampleRate (processingRate);
+        controlComp[ch].setSampleRate (processingRate);
+        lowDynamic[ch].setSampleRate (processingRate);
+        eq[ch].setSampleRate (processingRate);
+        styleComp[ch].setSampleRate (processingRate);
+        console[ch].setSampleRate (processingRate);
+        outStage[ch].setSampleRate (processingRate);
+        volume[ch].setSampleRate (processingRate);
     }
 
-    // Update all sections with current parameter values
+    // Allocate the selected algorithms' state, then select them (every
+    // section setter runs again: the sample rate may have changed)
+    // NOTE: The audio thread is stopped here, so allocation is safe
+    updateAlgorithmStates();
+    parameterEvents.requestResync();
+    parameterSnapshot.markAllChanged();
     updateAllSections();
 
-    // Initialize metering ballistics
-    peakDecayCoeff = std::exp (-1.0f / (0.2f * static_cast<float> (sampleRate)));  // 200ms decay
-    outStageAttackCoeff = std::exp (-1.0f / (0.01f * static_cast<float> (sampleRate)));  // 10ms attack
-    outStageReleaseCoeff = std::exp (-1.0f / (0.05f * static_cast<float> (sampleRate)));  // 50ms release
+    // Initialize metering ballistics (meters run inside the chain, at the processing rate)
+    peakDecayCoeff = std::exp (-1.0f / (0.2f * static_cast<float> (processingRate)));  // 200ms decay
+    outStageAttackCoeff = std::exp (-1.0f / (0.01f * static_cast<float> (processingRate)));  // 10ms attack
+    outStageReleaseCoeff = std::exp (-1.0f / (0.05f * static_cast<float> (processingRate)));  // 50ms release
+
+    // Pre-warm in the host's precision (the block 1 code path), then start
+    // from clean state (sections never reset themselves on the audio thread)
+    if (isUsingDoublePrecision())
+        primeProcessingChain<double> (ecoMaxBlockSize);
+    else
+        primeProcessingChain<float> (ecoMaxBlockSize);
+
+    resetProcessingState();
+}
+
+void AnalogChannelAudioProcessor::prepareScratchArena()
+{
+    // The chain runs in the host's precision, or in float between the eco
+    // resamplers. Sections never see more than one chain chunk.
+    const int maxInternalBlockSize = PolyphaseResampler::getMaxInternalBlockSize (maxBlockSize, ecoFactor);
+    const int maxSectionBlockSize = juce::jmin (chainChunkSize, maxInternalBlockSize);
+    const bool isChainDouble = isUsingDoublePrecision() && ecoFactor <= 1;
+    constexpr int numSectionsPerChannel = 9;
+
+    scratchArena.clear();
 
-    // Reset meter state
+    ScratchArena::Region ecoRegions[2];
+    ScratchArena::Region sectionRegions[2][numSectionsPerChannel];
+    std::array<BypassableSection*, numSectionsPerChannel> sections[2];
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        sections[ch] = { &preInput[ch], &filters[ch], &controlComp[ch], &lowDynamic[ch],
+                         &eq[ch], &styleComp[ch], &console[ch], &outStage[ch], &volume[ch] };
+
+        ecoRegions[ch] = scratchArena.reserve<float> (ecoFactor > 1 ? maxInternalBlockSize : 0);
+
+        // Bypass crossfade plus the section's own blocks (mix dry copies, linked gains)
+        for (int i = 0; i < numSectionsPerChannel; ++i)
+        {
+            const int numValues = sections[ch][i]->getNumScratchBlocks() * maxSectionBlockSize;
+            sectionRegions[ch][i] = isChainDouble ? scratchArena.reserve<double> (numValues)
+                                                  : scratchArena.reserve<float> (numValues);
+        }
+    }
+
+    scratchArena.allocate();
+
+    float* ecoChannels[2] = { scratchArena.get<float> (ecoRegions[0]), scratchArena.get<float> (ecoRegions[1]) };
+
+    if (ecoFactor > 1)
+        ecoInternalBuffer.setDataToReferTo (ecoChannels, 2, maxInternalBlockSize);
+    else
+        ecoInternalBuffer.setSize (2, 0);
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        for (int i = 0; i < numSectionsPerChannel; ++i)
+        {
+            if (isChainDouble)
+                sections[ch][i]->setScratch (scratchArena.get<double> (sectionRegions[ch][i]), maxSectionBlockSize);
+            else
+                sections[ch][i]->setScratch (scratchArena.get<float> (sectionRegions[ch][i]), maxSectionBlockSize);
+        }
+    }
+}
+
+template <typename SampleType>
+void AnalogChannelAudioProcessor::primeProcessingChain (int numSamples)
+{
+    // Silence through the same path as the first real block. Section reset()
+    // already touches the algorithm state; this also faults in what only
+    // processing touches (eco internal buffer, resampler history, conversion
+    // paths), runs the per-block parameter updates and warms the caches.
+    // The buffer lives only for this call (message thread, audio thread stopped).
+    juce::AudioBuffer<SampleType> primingBlock (2, numSamples);
+    primingBlock.clear();
+
+    juce::ScopedNoDenormals noDenormals;
+    processChainAtInternalRate (primingBlock);
+}
+
+void AnalogChannelAudioProcessor::resetProcessingState()
+{
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        preInput[ch].reset();
+        filters[ch].reset();
+        controlComp[ch].reset();
+        lowDynamic[ch].reset();
+        eq[ch].reset();
+        styleComp[ch].reset();
+        console[ch].reset();
+        outStage[ch].reset();
+        volume[ch].reset();
+
+        ecoResamplers[ch].reset();
+        dryDelays[ch].reset();
+    }
+
+    // Meters: the priming block must not show up on the GUI
     inputPeakStateLeft = inputPeakStateRight = 0.0f;
     outputPeakStateLeft = outputPeakStateRight = 0.0f;
-    outStageInputRMSLeft = outStageInputRMSRight = 0.0f;
-    outStageOutputRMSLeft = outStageOutputRMSRight = 0.0f;
+    outStageRMS[0] = outStageRMS[1] = {};
     outStageGRSmoothLeft = outStageGRSmoothRight = 0.0f;
+
+    for (auto* meter : { &inputPeakLeft, &inputPeakRight, &outputPeakLeft, &outputPeakRight,
+                         &controlCompGRLeft, &controlCompGRRight, &styleCompGRLeft, &styleCompGRRight,
+                         &outStageGRLeft, &outStageGRRight })
+        meter->store (0.0f, std::memory_order_relaxed);
 }
 
 void AnalogChannelAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
+    workerPool.release();
+}
+
+void AnalogChannelAudioProcessor::setNonRealtime (bool isNonRealtime) noexcept
+{
+    AudioProcessor::setNonRealtime (isNonRealtime);
+
+    // Hosts may call this from the render thread: nothing is allocated here.
+    // The message thread (handleAsyncUpdate) allocates every algorithm's
+    // state for a render and frees it again afterwards, and starts the
+    // worker; most hosts follow with prepareToPlay, which does the same
+    triggerAsyncUpdate();
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -206,150 +378,376 @@ bool AnalogChannelAudioProcessor::isBusesLayoutSupported (const BusesLayout& lay
 
 void AnalogChannelAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
-    juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused (midiMessages);
+    processBlockWithHostBypass (buffer, hostBypass != nullptr && hostBypass->get());
+}
+
+void AnalogChannelAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    processBlockWithHostBypass (buffer, hostBypass != nullptr && hostBypass->get());
+}
+
+void AnalogChannelAudioProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    // Hosts that don't use getBypassParameter() call this while the plugin is bypassed
+    juce::ignoreUnused (midiMessages);
+    processBlockWithHostBypass (buffer, true);
+}
+
+void AnalogChannelAudioProcessor::processBlockBypassed (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    processBlockWithHostBypass (buffer, true);
+}
+
+bool AnalogChannelAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    // Most Airwindows ports compute in double: a double host skips the
+    // float round trip between them
+    return true;
+}
+
+juce::AudioProcessorParameter* AnalogChannelAudioProcessor::getBypassParameter() const
+{
+    return hostBypass;
+}
+
+template <typename SampleType>
+void AnalogChannelAudioProcessor::processBlockWithHostBypass (juce::AudioBuffer<SampleType>& buffer, bool shouldBypass)
+{
+    juce::ScopedNoDenormals noDenormals;
 
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // Larger blocks are still processed correctly (everything sized from the
+    // announced block size works in chunks), but the host broke its contract
+    jassert (numSamples <= maxBlockSize);
 
     // Clear any extra output channels
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear (i, 0, buffer.getNumSamples());
+        buffer.clear (i, 0, numSamples);
+
+    const int numChannels = juce::jmin (2, totalNumInputChannels, buffer.getNumChannels());
+
+    // Analyser taps (one atomic load each while no editor shows the analyser)
+    spectrumAnalyser.push (SpectrumAnalyser::Input, buffer, numChannels);
+
+    // Fully bypassed: input is already in place, so pass-through costs nothing
+    // (apart from the eco mode latency, which the dry signal must match).
+    // Meters decay once per block instead of per sample.
+    const int targetWetPosition = shouldBypass ? 0 : hostBypassFadeSamples;
+
+    if (hostBypassWetPosition == targetWetPosition)
+    {
+        if (shouldBypass)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                dryDelays[ch].process (buffer.getReadPointer (ch), buffer.getWritePointer (ch), numSamples);
+
+            decayMetersForBypass (numSamples);
+        }
+        else
+        {
+            // Keep the dry delay current for the next bypass change
+            for (int ch = 0; ch < numChannels; ++ch)
+                dryDelays[ch].process (buffer.getReadPointer (ch), nullptr, numSamples);
+
+            processChainAtInternalRate (buffer);
+        }
+
+        spectrumAnalyser.push (SpectrumAnalyser::Output, buffer, numChannels);
+        return;
+    }
+
+    // Bypass change: a 10ms crossfade, continued over as many blocks as it
+    // takes (the position is kept between blocks, a change back mid-fade
+    // reverses it). The ramp region of each block fits the buffer allocated
+    // in prepareToPlay.
+    auto& hostBypassDryBuffer = std::get<juce::AudioBuffer<SampleType>> (hostBypassDryBuffers);
+    const int direction = shouldBypass ? -1 : 1;
+    const int fadeLength = juce::jmin (numSamples, std::abs (targetWetPosition - hostBypassWetPosition),
+                                       hostBypassDryBuffer.getNumSamples());
+    const auto fadeScale = 1.0f / static_cast<float> (hostBypassFadeSamples);
+    const float wetStart = static_cast<float> (hostBypassWetPosition) * fadeScale;
+    const float wetEnd = static_cast<float> (hostBypassWetPosition + direction * fadeLength) * fadeScale;
+
+    if (shouldBypass)
+    {
+        // Fade out: process only the crossfade region (in the side buffer), the
+        // whole block becomes the (delayed) dry signal
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            hostBypassDryBuffer.copyFrom (ch, 0, buffer, ch, 0, fadeLength);
+            dryDelays[ch].process (buffer.getReadPointer (ch), buffer.getWritePointer (ch), numSamples);
+        }
+
+        juce::AudioBuffer<SampleType> fadeRegion (hostBypassDryBuffer.getArrayOfWritePointers(), hostBypassDryBuffer.getNumChannels(), fadeLength);
+        processChainAtInternalRate (fadeRegion);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            buffer.applyGainRamp (ch, 0, fadeLength, 1.0f - wetStart, 1.0f - wetEnd);
+            buffer.addFromWithRamp (ch, 0, hostBypassDryBuffer.getReadPointer (ch), fadeLength, wetStart, wetEnd);
+        }
+    }
+    else
+    {
+        // Fade in from full bypass: the resamplers restart from silence rather
+        // than from stale history
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            dryDelays[ch].process (buffer.getReadPointer (ch), hostBypassDryBuffer.getWritePointer (ch), fadeLength);
+            dryDelays[ch].process (buffer.getReadPointer (ch, fadeLength), nullptr, numSamples - fadeLength);
+
+            if (hostBypassWetPosition == 0)
+                ecoResamplers[ch].reset();
+        }
+
+        // Process the whole block, blend the dry copy out over the crossfade region
+        processChainAtInternalRate (buffer);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            buffer.applyGainRamp (ch, 0, fadeLength, wetStart, wetEnd);
+            buffer.addFromWithRamp (ch, 0, hostBypassDryBuffer.getReadPointer (ch), fadeLength, 1.0f - wetStart, 1.0f - wetEnd);
+        }
+    }
+
+    hostBypassWetPosition += direction * fadeLength;
+    spectrumAnalyser.push (SpectrumAnalyser::Output, buffer, numChannels);
+}
+
+void AnalogChannelAudioProcessor::decayMetersForBypass (int numSamples)
+{
+    // While bypassed the meters don't track the signal: peak and GR readings
+    // decay to zero at the normal peak release rate, one multiply per block
+    // (the decay coefficient is per processing-rate sample)
+    const float blockDecay = std::pow (peakDecayCoeff, static_cast<float> (numSamples) / static_cast<float> (ecoFactor));
+
+    for (auto* meter : { &inputPeakLeft, &inputPeakRight, &outputPeakLeft, &outputPeakRight,
+                         &controlCompGRLeft, &controlCompGRRight, &styleCompGRLeft, &styleCompGRRight,
+                         &outStageGRLeft, &outStageGRRight })
+        meter->store (meter->load (std::memory_order_relaxed) * blockDecay, std::memory_order_relaxed);
+
+    inputPeakStateLeft *= blockDecay;
+    inputPeakStateRight *= blockDecay;
+    outputPeakStateLeft *= blockDecay;
+    outputPeakStateRight *= blockDecay;
+}
+
+template <typename SampleType>
+void AnalogChannelAudioProcessor::processChainAtInternalRate (juce::AudioBuffer<SampleType>& buffer)
+{
+    if (ecoFactor <= 1)
+    {
+        processChain (buffer);
+        return;
+    }
+
+    const int numChannels = juce::jmin (2, getTotalNumInputChannels(), buffer.getNumChannels());
+    const int numSamples = buffer.getNumSamples();
+
+    // Down - process - up, in chunks that fit the buffers sized in prepareToPlay
+    for (int offset = 0; offset < numSamples; offset += ecoMaxBlockSize)
+    {
+        const int numHostSamples = juce::jmin (ecoMaxBlockSize, numSamples - offset);
+        int numInternalSamples = 0;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            numInternalSamples = ecoResamplers[ch].downsample (buffer.getReadPointer (ch, offset), numHostSamples,
+                                                               ecoInternalBuffer.getWritePointer (ch));
+
+        if (numInternalSamples > 0)
+        {
+            juce::AudioBuffer<float> internalBlock (ecoInternalBuffer.getArrayOfWritePointers(),
+                                                    ecoInternalBuffer.getNumChannels(), numInternalSamples);
+            processChain (internalBlock);
+        }
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            ecoResamplers[ch].upsample (ecoInternalBuffer.getReadPointer (ch), numInternalSamples,
+                                        buffer.getWritePointer (ch, offset), numHostSamples);
+    }
+}
+
+template <typename SampleType>
+void AnalogChannelAudioProcessor::processChain (juce::AudioBuffer<SampleType>& buffer)
+{
+    auto totalNumInputChannels = getTotalNumInputChannels();
 
     // Update all sections with current parameter values
     updateAllSections();
 
+    // An algorithm was selected whose state isn't allocated yet (e.g. automation
+    // arrived before the listener ran): the section keeps running its current
+    // algorithm until the message thread has allocated the new state.
+    // Offline renders hold every algorithm's state (allocated before the
+    // render starts), so their switches are sample-accurate without this.
+    if (sectionsNeedAlgorithmStateUpdate())
+        triggerAsyncUpdate();
+
     // Process stereo channels independently (dual-mono)
     // We support up to 2 channels (stereo)
     const int numChannelsToProcess = juce::jmin (2, totalNumInputChannels);
 
-    // Reset RMS accumulators at start of buffer
-    outStageInputRMSLeft = outStageInputRMSRight = 0.0f;
-    outStageOutputRMSLeft = outStageOutputRMSRight = 0.0f;
+    if (numChannelsToProcess <= 0)
+        return;
 
-    // Read position parameters once per buffer (not per sample for efficiency)
-    auto filtersPostParam = parameters.getRawParameterValue ("filtersPost");
-    bool filtersPostOutStage = (filtersPostParam != nullptr && *filtersPostParam > 0.5f);
+    // Reset RMS accumulators at start of buffer
+    outStageRMS[0] = outStageRMS[1] = {};
 
-    auto styleCompPreEQParam = parameters.getRawParameterValue ("styleCompPreEQ");
-    bool styleCompPreEQ = (styleCompPreEQParam != nullptr && *styleCompPreEQParam > 0.5f);
+    // Routing and link options from the block's snapshot (updateAllSections())
+    const bool filtersPostOutStage = parameterSnapshot.getBool (ParameterSnapshot::FiltersPost);
+    const bool styleCompPreEQ = parameterSnapshot.getBool (ParameterSnapshot::StyleCompPreEQ);
+    const auto ctrlCompLink = static_cast<StereoLink::Mode> (parameterSnapshot.getChoice (ParameterSnapshot::CtrlCompLink));
+    const auto styleCompLink = static_cast<StereoLink::Mode> (parameterSnapshot.getChoice (ParameterSnapshot::StyleCompLink));
 
-    for (int channel = 0; channel < numChannelsToProcess; ++channel)
+    // Signal flow: 8 sections in series, each processing a chunk in place.
+    // Sections run stage by stage over both channels, so the stereo-linked dynamics
+    // see L and R together (dual-mono sections are unaffected by the ordering).
+    const int numSamples = buffer.getNumSamples();
+    SampleType* channelData[2] = { buffer.getWritePointer (0),
+                              buffer.getWritePointer (numChannelsToProcess > 1 ? 1 : 0) };
+    const bool isStereo = (numChannelsToProcess > 1);
+
+    // Whether a linked stage couples the channels is known before the chain
+    // runs (it depends only on each section's own bypass state)
+    const bool linkControlComp = isStereo && ctrlCompLink != StereoLink::Off
+                              && ControlCompSection::canProcessLinked (controlComp[0], controlComp[1]);
+    const bool linkStyleComp = isStereo && styleCompLink != StereoLink::Off
+                            && StyleCompSection::canProcessLinked (styleComp[0], styleComp[1]);
+
+    // The chain over channels [firstChannel, endChannel), chunk by chunk:
+    // every section runs over one chunk before the next chunk starts, so the
+    // samples stay in cache across the chain however large the host block.
+    // A section's bypass fade simply continues in the next chunk (its ramp
+    // position is section state), so chunking never shortens it.
+    // Linked stages only run when the range holds both channels.
+    auto processChannels = [&] (int firstChannel, int endChannel)
     {
-        auto* channelData = buffer.getWritePointer (channel);
-        const int numSamples = buffer.getNumSamples();
+        const bool hasBothChannels = (firstChannel == 0 && endChannel == 2);
+        SampleType* chunk[2] = { nullptr, nullptr };
+        int chunkSize = 0;
 
-        // Process each sample through the signal chain
-        for (int sample = 0; sample < numSamples; ++sample)
+        auto processDualMono = [&] (auto& sections)
         {
-            float signal = channelData[sample];
+            for (int channel = firstChannel; channel < endChannel; ++channel)
+                sections[channel].processBlock (chunk[channel], chunkSize);
+        };
 
-            // === INPUT PEAK METERING ===
-            {
-                float inputLevel = std::abs (signal);
-                float& peakState = (channel == 0) ? inputPeakStateLeft : inputPeakStateRight;
+        auto processControlComp = [&]
+        {
+            if (hasBothChannels && linkControlComp)
+                ControlCompSection::processStereoLinked (controlComp[0], controlComp[1],
+                                                         chunk[0], chunk[1], chunkSize, ctrlCompLink);
+            else
+                processDualMono (controlComp);
+        };
 
-                if (inputLevel > peakState)
-                    peakState = inputLevel;  // Instant attack
-                else
-                    peakState *= peakDecayCoeff;  // Exponential decay
+        auto processStyleComp = [&]
+        {
+            if (hasBothChannels && linkStyleComp)
+                StyleCompSection::processStereoLinked (styleComp[0], styleComp[1],
+                                                       chunk[0], chunk[1], chunkSize, styleCompLink);
+            else
+                processDualMono (styleComp);
+        };
 
-                if (channel == 0)
-                    inputPeakLeft.store (peakState, std::memory_order_relaxed);
-                else
-                    inputPeakRight.store (peakState, std::memory_order_relaxed);
-            }
+        for (int chunkStart = 0; chunkStart < numSamples; chunkStart += chainChunkSize)
+        {
+            chunkSize = juce::jmin (chainChunkSize, numSamples - chunkStart);
+
+            for (int channel = firstChannel; channel < endChannel; ++channel)
+                chunk[channel] = channelData[channel] + chunkStart;
 
-            // Signal flow: 8 sections in series
-            signal = preInput[channel].process (signal);
+            processDualMono (preInput);
 
             // Filters position depends on filtersPost parameter (read once per buffer above)
             if (!filtersPostOutStage)
             {
-                signal = filters[channel].process (signal);  // Normal position (before dynamics)
+                processDualMono (filters);  // Normal position (before dynamics)
             }
 
-            signal = controlComp[channel].process (signal);
-            signal = lowDynamic[channel].process (signal);
+            processControlComp();
+            processDualMono (lowDynamic);
 
             // Style-Comp position depends on styleCompPreEQ parameter (read once per buffer above)
             if (styleCompPreEQ)
             {
-                signal = styleComp[channel].process (signal);  // Pre-EQ position (after ControlComp)
+                processStyleComp();  // Pre-EQ position (after ControlComp)
             }
 
-            signal = eq[channel].process (signal);
+            processDualMono (eq);
 
             if (!styleCompPreEQ)
             {
-                signal = styleComp[channel].process (signal);  // Normal position (after EQ)
+                processStyleComp();  // Normal position (after EQ)
             }
 
-            signal = console[channel].process (signal);
+            processDualMono (console);
 
-            // === OUTSTAGE GR DETECTION (accumulate RMS before and after OutStage only) ===
-            float outStageInput = signal;
-            signal = outStage[channel].process (signal);
-            float outStageOutput = signal;  // Capture output BEFORE filters POST
-
-            // Accumulate squared values for RMS calculation (OutStage only, independent of filters)
-            if (channel == 0)
-            {
-                outStageInputRMSLeft += outStageInput * outStageInput;
-                outStageOutputRMSLeft += outStageOutput * outStageOutput;
-            }
-            else
+            for (int channel = firstChannel; channel < endChannel; ++channel)
             {
-                outStageInputRMSRight += outStageInput * outStageInput;
-                outStageOutputRMSRight += outStageOutput * outStageOutput;
+                // === OUTSTAGE GR DETECTION (accumulate RMS before and after OutStage only) ===
+                // Accumulate squared values for RMS calculation (OutStage only, independent of filters)
+                auto& rms = outStageRMS[channel];
+
+                rms.input += getSumOfSquares (chunk[channel], chunkSize);
+                outStage[channel].processBlock (chunk[channel], chunkSize);
+                rms.output += getSumOfSquares (chunk[channel], chunkSize);  // Capture output BEFORE filters POST
             }
 
             // Apply filters AFTER OutStage if POST mode is active
             if (filtersPostOutStage)
             {
-                signal = filters[channel].process (signal);  // Post-OutStage position (after all processing)
+                processDualMono (filters);  // Post-OutStage position (after all processing)
             }
 
-            signal = volume[channel].process (signal);
-
-            // === OUTPUT PEAK METERING ===
-            {
-                float outputLevel = std::abs (signal);
-                float& outPeakState = (channel == 0) ? outputPeakStateLeft : outputPeakStateRight;
+            processDualMono (volume);
+        }
+    };
 
-                if (outputLevel > outPeakState)
-                    outPeakState = outputLevel;  // Instant attack
-                else
-                    outPeakState *= peakDecayCoeff;  // Exponential decay
+    // === INPUT PEAK METERING ===
+    for (int channel = 0; channel < numChannelsToProcess; ++channel)
+    {
+        float& peakState = (channel == 0) ? inputPeakStateLeft : inputPeakStateRight;
+        updatePeakMeter (channelData[channel], numSamples, peakState);
+        (channel == 0 ? inputPeakLeft : inputPeakRight).store (peakState, std::memory_order_relaxed);
+    }
 
-                if (channel == 0)
-                    outputPeakLeft.store (outPeakState, std::memory_order_relaxed);
-                else
-                    outputPeakRight.store (outPeakState, std::memory_order_relaxed);
-            }
+    // Multicore: with no linked stage the channels are independent, and each
+    // runs the whole chain as one task (the caller takes whatever no worker has)
+    if (isStereo && ! linkControlComp && ! linkStyleComp && shouldProcessChannelsInParallel (numSamples))
+    {
+        auto processChannel = [&] (int channel) { processChannels (channel, channel + 1); };
+        workerPool.run (numChannelsToProcess, processChannel);
+    }
+    else
+    {
+        processChannels (0, numChannelsToProcess);
+    }
 
-            channelData[sample] = signal;
-        }
+    for (int channel = 0; channel < numChannelsToProcess; ++channel)
+    {
+        // === OUTPUT PEAK METERING ===
+        float& outPeakState = (channel == 0) ? outputPeakStateLeft : outputPeakStateRight;
+        updatePeakMeter (channelData[channel], numSamples, outPeakState);
+        (channel == 0 ? outputPeakLeft : outputPeakRight).store (outPeakState, std::memory_order_relaxed);
 
         // === COMPRESSOR GR METERS (once per buffer, per channel) ===
-        if (channel == 0)
-        {
-            controlCompGRLeft.store (controlComp[0].getGainReductionDB(), std::memory_order_relaxed);
-            styleCompGRLeft.store (styleComp[0].getGainReductionDB(), std::memory_order_relaxed);
-        }
-        else
-        {
-            controlCompGRRight.store (controlComp[1].getGainReductionDB(), std::memory_order_relaxed);
-            styleCompGRRight.store (styleComp[1].getGainReductionDB(), std::memory_order_relaxed);
-        }
+        (channel == 0 ? controlCompGRLeft : controlCompGRRight).store (controlComp[channel].getGainReductionDB(), std::memory_order_relaxed);
+        (channel == 0 ? styleCompGRLeft : styleCompGRRight).store (styleComp[channel].getGainReductionDB(), std::memory_order_relaxed);
     }
 
     // === OUTSTAGE GR DETECTION (once per buffer, after all channels) ===
-    const int numSamples = buffer.getNumSamples();
+    const float rmsLength = static_cast<float> (juce::jmax (1, numSamples));
 
     // Left channel
-    float inputRMS_L = std::sqrt (outStageInputRMSLeft / numSamples);
-    float outputRMS_L = std::sqrt (outStageOutputRMSLeft / numSamples);
+    float inputRMS_L = std::sqrt (outStageRMS[0].input / rmsLength);
+    float outputRMS_L = std::sqrt (outStageRMS[0].output / rmsLength);
     float inputDB_L = juce::Decibels::gainToDecibels (inputRMS_L + 1e-10f);
     float outputDB_L = juce::Decibels::gainToDecibels (outputRMS_L + 1e-10f);
     float grDB_L = outputDB_L - inputDB_L;  // Negative if reducing
@@ -360,8 +758,8 @@ void AnalogChannelAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
     // Right channel (if stereo)
     if (numChannelsToProcess > 1)
     {
-        float inputRMS_R = std::sqrt (outStageInputRMSRight / numSamples);
-        float outputRMS_R = std::sqrt (outStageOutputRMSRight / numSamples);
+        float inputRMS_R = std::sqrt (outStageRMS[1].input / rmsLength);
+        float outputRMS_R = std::sqrt (outStageRMS[1].output / rmsLength);
         float inputDB_R = juce::Decibels::gainToDecibels (inputRMS_R + 1e-10f);
         float outputDB_R = juce::Decibels::gainToDecibels (outputRMS_R + 1e-10f);
         float grDB_R = outputDB_R - inputDB_R;
@@ -371,6 +769,36 @@ void AnalogChannelAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
     }
 }
 
+//==============================================================================
+template <typename SampleType>
+void AnalogChannelAudioProcessor::updatePeakMeter (const SampleType* data, int numSamples, float& peakState) const
+{
+    // Instant attack, exponential decay - evaluated per block (the meter is
+    // read at GUI rate, so in-block decay after an early peak isn't visible)
+    const float blockDecay = std::pow (peakDecayCoeff, static_cast<float> (numSamples));
+    peakState = juce::jmax (getPeak (data, numSamples), peakState * blockDecay);
+}
+
+float AnalogChannelAudioProcessor::getPeak (const float* data, int numSamples)
+{
+    return BlockKernels::findPeak (data, numSamples);
+}
+
+float AnalogChannelAudioProcessor::getPeak (const double* data, int numSamples)
+{
+    return static_cast<float> (BlockKernels::findPeak (data, numSamples));
+}
+
+float AnalogChannelAudioProcessor::getSumOfSquares (const float* data, int numSamples)
+{
+    return BlockKernels::sumOfSquares (data, numSamples);
+}
+
+float AnalogChannelAudioProcessor::getSumOfSquares (const double* data, int numSamples)
+{
+    return static_cast<float> (BlockKernels::sumOfSquares (data, numSamples));
+}
+
 //==============================================================================
 bool AnalogChannelAudioProcessor::hasEditor() const
 {
@@ -410,11 +838,21 @@ void AnalogChannelAudioProcessor::setStateInformation (const void* data, int siz
                 zoomIndex = juce::jlimit (0, 3, zoomIndex); // Clamp to valid range
 
                 // Save to PropertiesFile (overwrite if already set)
+                // If the settings file has not been opened yet, defer the write to
+                // the first editor access instead of touching the disk during load.
+                // Hosts may restore state off the message thread while the editor
+                // reads the settings: both sides hold guiSettingsLock.
+                const juce::ScopedLock sl (guiSettingsLock);
+
                 if (guiSettings != nullptr)
                 {
                     guiSettings->setValue ("guiZoom", zoomIndex);
                     guiSettings->saveIfNeeded();
                 }
+                else
+                {
+                    pendingGuiZoomMigration = zoomIndex;
+                }
 
                 // Remove guiZoom from state to clean up old parameter
                 valueTree.removeProperty ("guiZoom", nullptr);
@@ -428,228 +866,225 @@ void AnalogChannelAudioProcessor::setStateInformation (const void* data, int siz
 //==============================================================================
 void AnalogChannelAudioProcessor::updateAllSections()
 {
-    // Get parameter values
-    auto preInputAlgo = parameters.getRawParameterValue ("preInputAlgo");
-    auto preInputDrive = parameters.getRawParameterValue ("preInputDrive");
-    auto preInputBypass = parameters.getRawParameterValue ("preInputBypass");
+    // Apply the parameter events queued since the last block; the sections
+    // re-run their setters only for fields that changed
+    parameterEvents.drainInto (parameterSnapshot, parameterSources);
 
-    auto hpfFreq = parameters.getRawParameterValue ("hpfFreq");
-    auto hpfSlope = parameters.getRawParameterValue ("hpfSlope");
-    auto hpfQ = parameters.getRawParameterValue ("hpfQ");
-    auto lpfFreq = parameters.getRawParameterValue ("lpfFreq");
-    auto lpfSlope = parameters.getRawParameterValue ("lpfSlope");
-    auto lpfQ = parameters.getRawParameterValue ("lpfQ");
-    auto filtersBypass = parameters.getRawParameterValue ("filtersBypass");
+    // Update all sections (dual-mono)
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        // Channel variation offsets (neutral when variation is Off)
+        const auto variation = parameterSnapshot.getChannelVariation (ch);
+
+        preInput[ch].applyParameters (parameterSnapshot);                  // Section 1: Pre-Input
+        filters[ch].applyParameters (parameterSnapshot, variation);        // Section 2: Filters
+        controlComp[ch].applyParameters (parameterSnapshot);               // Section 3: Control-Comp
+        lowDynamic[ch].applyParameters (parameterSnapshot);                // Section 3.5: Low Dynamic
+        eq[ch].applyParameters (parameterSnapshot, variation);             // Section 4: EQ
+        styleComp[ch].applyParameters (parameterSnapshot);                 // Section 5: Style-Comp
+        console[ch].applyParameters (parameterSnapshot, variation);        // Section 6: Console
+        outStage[ch].applyParameters (parameterSnapshot);                  // Section 7: OutStage
+        volume[ch].applyParameters (parameterSnapshot, variation);         // Section 8: Volume
+    }
 
-    auto ctrlCompThresh = parameters.getRawParameterValue ("ctrlCompThresh");
-    auto ctrlCompAR = parameters.getRawParameterValue ("ctrlCompAR");
-    auto ctrlCompBypass = parameters.getRawParameterValue ("ctrlCompBypass");
+    parameterSnapshot.clearChanges();
+}
 
-    auto styleCompAlgo = parameters.getRawParameterValue ("styleCompAlgo");
-    auto styleCompIn = parameters.getRawParameterValue ("styleCompIn");
-    auto styleCompMakeup = parameters.getRawParameterValue ("styleCompMakeup");
-    auto styleCompMix = parameters.getRawParameterValue ("styleCompMix");
-    auto styleCompBypass = parameters.getRawParameterValue ("styleCompBypass");
+//==============================================================================
+// Algorithm State Allocation
+//==============================================================================
 
-    auto consoleAlgo = parameters.getRawParameterValue ("consoleAlgo");
-    auto consoleDrive = parameters.getRawParameterValue ("consoleDrive");
-    auto consoleBypass = parameters.getRawParameterValue ("consoleBypass");
+void AnalogChannelAudioProcessor::parameterChanged (const juce::String& parameterID, float newValue)
+{
+    juce::ignoreUnused (parameterID, newValue);
 
-    auto outStageAlgo = parameters.getRawParameterValue ("outStageAlgo");
-    auto outStageDrive = parameters.getRawParameterValue ("outStageDrive");
-    auto outStageBypass = parameters.getRawParameterValue ("outStageBypass");
+    // May be called on the audio thread (automation), so defer to the message thread
+    triggerAsyncUpdate();
+}
 
-    auto outputGain = parameters.getRawParameterValue ("outputGain");
-    auto volumeBypass = parameters.getRawParameterValue ("volumeBypass");
+void AnalogChannelAudioProcessor::handleAsyncUpdate()
+{
+    updateAlgorithmStates();
+    updateEcoMode();
+    updateMulticore();
+}
 
-    // Channel Variation parameters
-    auto channelVariationMode = parameters.getRawParameterValue ("channelVariationMode");
-    auto channelPair = parameters.getRawParameterValue ("channelPair");
+//==============================================================================
+// Eco Mode
+//==============================================================================
 
-    // Update all sections (dual-mono)
-    for (int ch = 0; ch < 2; ++ch)
-    {
-        // Determine which channel variation preset to use
-        int variationIndex = -1;  // -1 = no variation (Off mode)
+bool AnalogChannelAudioProcessor::isOptionSet (ParameterSnapshot::Field field) const
+{
+    // Message thread: the snapshot's cached source (the block snapshot
+    // belongs to the audio thread)
+    const auto* source = parameterSources[static_cast<std::size_t> (field)];
+    return source != nullptr && source->load (std::memory_order_relaxed) > 0.5f;
+}
 
-        if (channelVariationMode != nullptr && channelPair != nullptr)
-        {
-            int mode = static_cast<int> (*channelVariationMode);
-            int pair = static_cast<int> (*channelPair);
+bool AnalogChannelAudioProcessor::isEcoModeRequested() const
+{
+    return isOptionSet (ParameterSnapshot::EcoMode);
+}
 
-            if (mode == 1)  // Stereo mode (L≠R)
-            {
-                variationIndex = pair * 2 + ch;  // pair 0: ch0→0, ch1→1; pair 1: ch0→2, ch1→3, etc.
-            }
-            else if (mode == 2)  // Mono mode (L=R, both use left channel preset)
-            {
-                variationIndex = pair * 2;  // Both channels use the left channel of the pair
-            }
-            // mode == 0 (Off): variationIndex stays -1
-        }
+bool AnalogChannelAudioProcessor::isMulticoreRequested() const
+{
+    return isOptionSet (ParameterSnapshot::Multicore);
+}
 
-        // Get channel variation preset (or use neutral if Off)
-        const auto& cv = (variationIndex >= 0 && variationIndex < ChannelVariations::NUM_CHANNELS)
-            ? ChannelVariations::presets[variationIndex]
-            : ChannelVariationPreset{};  // Neutral preset (all zeros)
-        // Section 1: Pre-Input
-        if (preInputAlgo != nullptr)
-            preInput[ch].setAlgorithm (static_cast<PreInputSection::Algorithm> (static_cast<int> (*preInputAlgo)));
-        if (preInputDrive != nullptr)
-            preInput[ch].setDrive (*preInputDrive);
-        if (preInputBypass != nullptr)
-            preInput[ch].setBypass (*preInputBypass > 0.5f);
-
-        // Section 2: Filters
-        if (hpfFreq != nullptr && hpfSlope != nullptr && hpfQ != nullptr)
-        {
-            FilterSection::Slope hpfSlopeEnum = (*hpfSlope < 0.5f)
-                ? FilterSection::Slope_12dB
-                : FilterSection::Slope_18dB;
-            FilterSection::QMode hpfQEnum = (*hpfQ < 0.5f)
-                ? FilterSection::Normal
-                : FilterSection::Bump;
-
-            // Apply channel variation freq offset
-            float hpfFreqWithVariation = *hpfFreq + cv.hpfFreq;
-            filters[ch].setHPF (hpfFreqWithVariation, hpfSlopeEnum, hpfQEnum);
-
-            // Apply channel variation Q offset
-            filters[ch].setHPFQOffset (cv.hpfQ);
-        }
+void AnalogChannelAudioProcessor::prepareWorkerPool (double sampleRate, int samplesPerBlock)
+{
+    // One worker for the second channel (the audio thread runs the first).
+    // It spins for most of a block period, so at steady state it usually
+    // picks the next block up without being woken, and runs as a realtime
+    // thread with the block period as its period.
+    isMulticoreEnabled = isMulticoreRequested();
 
-        if (lpfFreq != nullptr && lpfSlope != nullptr && lpfQ != nullptr)
-        {
-            FilterSection::Slope lpfSlopeEnum = (*lpfSlope < 0.5f)
-                ? FilterSection::Slope_6dB
-                : FilterSection::Slope_12dB;
-            FilterSection::QMode lpfQEnum = (*lpfQ < 0.5f)
-                ? FilterSection::Normal
-                : FilterSection::Bump;
-
-            // Apply channel variation freq offset
-            float lpfFreqWithVariation = *lpfFreq + cv.lpfFreq;
-            filters[ch].setLPF (lpfFreqWithVariation, lpfSlopeEnum, lpfQEnum);
-
-            // Apply channel variation Q offset
-            filters[ch].setLPFQOffset (cv.lpfQ);
-        }
+    const int numWorkers = (isMulticoreEnabled || isNonRealtime()) ? WorkerPool::getRecommendedNumWorkers (2) : 0;
+    const double blockPeriodMs = 1000.0 * static_cast<double> (juce::jmax (1, samplesPerBlock)) / sampleRate;
 
-        if (filtersBypass != nullptr)
-            filters[ch].setBypass (*filtersBypass > 0.5f);
+    workerPool.prepare (numWorkers, blockPeriodMs);
+}
 
-        // Section 3: Control-Comp
-        if (ctrlCompThresh != nullptr)
-            controlComp[ch].setThreshold (*ctrlCompThresh);
-        if (ctrlCompAR != nullptr)
-        {
-            // Parameter order: { "Normal", "Fast" }
-            // Index 0 (< 0.5) = Normal, Index 1 (>= 0.5) = Fast
-            ControlCompSection::ARMode arMode = (*ctrlCompAR < 0.5f)
-                ? ControlCompSection::Normal
-                : ControlCompSection::Fast;
-            controlComp[ch].setARMode (arMode);
-        }
-        if (ctrlCompBypass != nullptr)
-            controlComp[ch].setBypass (*ctrlCompBypass > 0.5f);
-
-        // Section 3.5: Low Dynamic
-        auto lowDynThresh = parameters.getRawParameterValue ("lowDynThresh");
-        auto lowDynRatio = parameters.getRawParameterValue ("lowDynRatio");
-        auto lowDynFast = parameters.getRawParameterValue ("lowDynFast");
-        auto lowDynMix = parameters.getRawParameterValue ("lowDynMix");
-        auto lowDynBypass = parameters.getRawParameterValue ("lowDynBypass");
-
-        if (lowDynThresh != nullptr)
-            lowDynamic[ch].setThreshold (*lowDynThresh);
-        if (lowDynRatio != nullptr)
-            lowDynamic[ch].setRatio (*lowDynRatio);
-        if (lowDynFast != nullptr)
-            lowDynamic[ch].setFastMode (*lowDynFast > 0.5f);
-        if (lowDynMix != nullptr)
-            lowDynamic[ch].setMix (*lowDynMix);
-        if (lowDynBypass != nullptr)
+bool AnalogChannelAudioProcessor::shouldProcessChannelsInParallel (int numSamples) const
+{
+    if (workerPool.getNumWorkers() == 0)
+        return false;
+
+    if (isNonRealtime())
+        return numSamples >= (isMulticoreEnabled ? minSamplesForParallelChannels : minSamplesForOfflineParallelChannels);
+
+    // Realtime: only on request (the worker may still be up from a render)
+    return isMulticoreEnabled && numSamples >= minSamplesForParallelChannels;
+}
+
+void AnalogChannelAudioProcessor::updateMulticore()
+{
+    if (getSampleRate() <= 0.0 || getBlockSize() <= 0)
+        return;  // Not prepared yet - prepareToPlay() picks the setting up
+
+    const bool isRunning = workerPool.getNumWorkers() > 0;
+    const bool needsWorkers = isMulticoreRequested() || isNonRealtime();
+
+    // A render ending leaves the worker up (asleep) until the next prepare
+    if (isMulticoreRequested() == isMulticoreEnabled && (isRunning || ! needsWorkers))
+        return;
+
+    // Workers start and stop only while the callback is held off
+    suspendProcessing (true);
+    prepareWorkerPool (getSampleRate(), getBlockSize());
+    suspendProcessing (false);
+}
+
+bool AnalogChannelAudioProcessor::isEcoPrecisionRequested() const
+{
+    return isOptionSet (ParameterSnapshot::EcoPrecision);
+}
+
+int AnalogChannelAudioProcessor::getEcoResamplingFactor (double sampleRate)
+{
+    // Only exact multiples of 44.1/48kHz (88.2, 96, 176.4, 192kHz, ...)
+    const int factor = juce::roundToInt (sampleRate / 48000.0);
+    const double processingRate = sampleRate / static_cast<double> (juce::jmax (1, factor));
+
+    if (factor > 1 && (processingRate == 44100.0 || processingRate == 48000.0))
+        return factor;
+
+    return 1;
+}
+
+void AnalogChannelAudioProcessor::updateEcoMode()
+{
+    if (getSampleRate() <= 0.0 || getBlockSize() <= 0)
+        return;  // Not prepared yet - prepareToPlay() picks the mode up
+
+    const int requestedFactor = isEcoModeRequested() ? getEcoResamplingFactor (getSampleRate()) : 1;
+
+    if (requestedFactor == ecoFactor)
+        return;  // No change in processing rate (e.g. eco mode toggled in a 48kHz session)
+
+    // The processing rate changes: the resamplers, dry delay, scratch and
+    // sections are rebuilt for it (the host's rate, block size, workers and
+    // bypass state stay as prepared). The audio callback is held off meanwhile
+    // (a short dropout on a mode switch) and the new latency is reported to
+    // the host.
+    suspendProcessing (true);
+    prepareProcessingRate (getSampleRate(), requestedFactor);
+    suspendProcessing (false);
+}
+
+void AnalogChannelAudioProcessor::updateAlgorithmStates()
+{
+    auto* preInputAlgo = parameterSources[ParameterSnapshot::PreInputAlgo];
+    auto* styleCompAlgo = parameterSources[ParameterSnapshot::StyleCompAlgo];
+    auto* consoleAlgo = parameterSources[ParameterSnapshot::ConsoleAlgo];
+    auto* outStageAlgo = parameterSources[ParameterSnapshot::OutStageAlgo];
+    const bool ecoPrecision = isEcoPrecisionRequested();
+
+    // Offline: every algorithm's state in the current precision stays
+    // allocated, so automation can switch algorithms mid-render without
+    // waiting for the message thread
+    if (isNonRealtime())
+    {
+        for (int ch = 0; ch < 2; ++ch)
         {
-            // CRITICAL: Bypass parameter is 1.0 when button is ON (bypassed)
-            bool shouldBypass = (*lowDynBypass > 0.5f);
-            lowDynamic[ch].setBypass (shouldBypass);
+            preInput[ch].allocateAllAlgorithmStates (ecoPrecision);
+            styleComp[ch].allocateAllAlgorithmStates();
+            console[ch].allocateAllAlgorithmStates (ecoPrecision);
+            outStage[ch].allocateAllAlgorithmStates (ecoPrecision);
         }
 
-        // Section 4: EQ
-        auto eqBass = parameters.getRawParameterValue ("eqBass");
-        auto eqBassFreq = parameters.getRawParameterValue ("eqBassFreq");
-        auto eqTreble = parameters.getRawParameterValue ("eqTreble");
-        auto eqTrebleFreq = parameters.getRawParameterValue ("eqTrebleFreq");
-        auto eqBell1Freq = parameters.getRawParameterValue ("eqBell1Freq");
-        auto eqBell1Gain = parameters.getRawParameterValue ("eqBell1Gain");
-        auto eqBell2Freq = parameters.getRawParameterValue ("eqBell2Freq");
-        auto eqBell2Gain = parameters.getRawParameterValue ("eqBell2Gain");
-        auto eqBypass = parameters.getRawParameterValue ("eqBypass");
-
-        // Apply channel variations to Bass shelf
-        if (eqBass != nullptr)
-            eq[ch].setBassShelf (*eqBass + cv.eqBassGain);
-        if (eqBassFreq != nullptr)
-            eq[ch].setBassShelfFreq (*eqBassFreq + cv.eqBassFreq);
-
-        // Apply channel variations to Treble shelf
-        if (eqTreble != nullptr)
-            eq[ch].setTrebleShelf (*eqTreble + cv.eqTrebleGain);
-        if (eqTrebleFreq != nullptr)
-            eq[ch].setTrebleShelfFreq (*eqTrebleFreq + cv.eqTrebleFreq);
-
-        // Apply channel variations to Bell 1
-        if (eqBell1Freq != nullptr && eqBell1Gain != nullptr)
-            eq[ch].setBell1WithVariation (static_cast<int> (*eqBell1Freq), *eqBell1Gain,
-                                          cv.eqBell1Freq, cv.eqBell1Gain, cv.eqBell1Q);
-
-        // Apply channel variations to Bell 2
-        if (eqBell2Freq != nullptr && eqBell2Gain != nullptr)
-            eq[ch].setBell2WithVariation (static_cast<int> (*eqBell2Freq), *eqBell2Gain,
-                                          cv.eqBell2Freq, cv.eqBell2Gain, cv.eqBell2Q);
-
-        if (eqBypass != nullptr)
-            eq[ch].setBypass (*eqBypass > 0.5f);
-
-        // Section 5: Style-Comp
+        return;
+    }
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        if (preInputAlgo != nullptr)
+            preInput[ch].updateAlgorithmStates (static_cast<PreInputSection::Algorithm> (static_cast<int> (*preInputAlgo)), ecoPrecision);
+
         if (styleCompAlgo != nullptr)
-        {
-            StyleCompSection::Algorithm styleAlgo = (*styleCompAlgo < 0.5f)
-                ? StyleCompSection::Warm
-                : StyleCompSection::Punch;
-            styleComp[ch].setAlgorithm (styleAlgo);
-        }
-        if (styleCompIn != nullptr)
-            styleComp[ch].setCompIn (*styleCompIn);
-        if (styleCompMakeup != nullptr)
-            styleComp[ch].setMakeup (*styleCompMakeup);
-        if (styleCompMix != nullptr)
-            styleComp[ch].setMix (*styleCompMix);
-        if (styleCompBypass != nullptr)
-            styleComp[ch].setBypass (*styleCompBypass > 0.5f);
-
-        // Section 6: Console
+            styleComp[ch].updateAlgorithmStates ((*styleCompAlgo < 0.5f) ? StyleCompSection::Warm
+                                                                          : StyleCompSection::Punch);
+
         if (consoleAlgo != nullptr)
-            console[ch].setAlgorithm (static_cast<ConsoleSection::Algorithm> (static_cast<int> (*consoleAlgo)));
-        if (consoleDrive != nullptr)
-            console[ch].setDrive (*consoleDrive + cv.consoleDrive);  // Apply channel variation
-        if (consoleBypass != nullptr)
-            console[ch].setBypass (*consoleBypass > 0.5f);
+            console[ch].updateAlgorithmStates (static_cast<ConsoleSection::Algorithm> (static_cast<int> (*consoleAlgo)), ecoPrecision);
 
-        // Section 7: OutStage
         if (outStageAlgo != nullptr)
-            outStage[ch].setAlgorithm (static_cast<OutStageSection::Algorithm> (static_cast<int> (*outStageAlgo)));
-        if (outStageDrive != nullptr)
-            outStage[ch].setDrive (*outStageDrive);
-        if (outStageBypass != nullptr)
-            outStage[ch].setBypass (*outStageBypass > 0.5f);
-
-        // Section 8: Volume
-        if (outputGain != nullptr)
-            volume[ch].setGain (*outputGain + cv.outputGain);  // Apply channel variation
-        if (volumeBypass != nullptr)
-            volume[ch].setBypass (*volumeBypass > 0.5f);
+            outStage[ch].updateAlgorithmStates (static_cast<OutStageSection::Algorithm> (static_cast<int> (*outStageAlgo)), ecoPrecision);
+    }
+}
+
+bool AnalogChannelAudioProcessor::sectionsNeedAlgorithmStateUpdate()
+{
+    bool needsUpdate = false;
+
+    // NOTE: Every flag must be polled (and cleared), so no short-circuiting
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        needsUpdate |= preInput[ch].needsAlgorithmStateUpdate();
+        needsUpdate |= styleComp[ch].needsAlgorithmStateUpdate();
+        needsUpdate |= console[ch].needsAlgorithmStateUpdate();
+        needsUpdate |= outStage[ch].needsAlgorithmStateUpdate();
+    }
+
+    return needsUpdate;
+}
+
+size_t AnalogChannelAudioProcessor::getInstanceStateBytes() const
+{
+    size_t total = sizeof (*this);
+
+    // Section objects are already counted in sizeof (*this)
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        total += preInput[ch].getStateBytes() - sizeof (PreInputSection);
+        total += styleComp[ch].getStateBytes() - sizeof (StyleCompSection);
+        total += console[ch].getStateBytes() - sizeof (ConsoleSection);
+        total += outStage[ch].getStateBytes() - sizeof (OutStageSection);
     }
+
+    total += scratchArena.getNumBytes();
+
+    return total;
 }
 
 //==============================================================================
@@ -730,6 +1165,11 @@ juce::AudioProcessorValueTreeState::ParameterLayout AnalogChannelAudioProcessor:
     params.push_back (std::make_unique<juce::AudioParameterBool> (
         "ctrlCompBypass", "Control-Comp Bypass", false));
 
+    params.push_back (std::make_unique<juce::AudioParameterChoice> (
+        "ctrlCompLink", "Control-Comp Stereo Link",
+        juce::StringArray { "Off", "Max", "Sum" },
+        0)); // Default: Off (dual-mono detectors)
+
     // ============================================================================
     // SECTION 3.5: Low Dynamic (Expander/Upward Compressor)
     // ============================================================================
@@ -846,6 +1286,11 @@ juce::AudioProcessorValueTreeState::ParameterLayout AnalogChannelAudioProcessor:
     params.push_back (std::make_unique<juce::AudioParameterBool> (
         "styleCompPreEQ", "Style-Comp Pre-EQ", false));
 
+    params.push_back (std::make_unique<juce::AudioParameterChoice> (
+        "styleCompLink", "Style-Comp Stereo Link",
+        juce::StringArray { "Off", "Max", "Sum" },
+        0)); // Default: Off (dual-mono detectors)
+
     // ============================================================================
     // SECTION 6: Console
     // ============================================================================
@@ -899,15 +1344,48 @@ juce::AudioProcessorValueTreeState::ParameterLayout AnalogChannelAudioProcessor:
 
     params.push_back (std::make_unique<juce::AudioParameterInt> (
         "channelPair", "Channel Pair",
-        0, 23, // 0-23 = channels 1-48 (pairs: 1|2, 3|4, ..., 47|48)
+        0, ChannelVariations::NUM_PAIRS - 1, // 0-23 = channels 1-48 (pairs: 1|2, 3|4, ..., 47|48)
         0)); // Default: pair 0 (channels 1|2)
 
+    // ============================================================================
+    // ECO MODE - process at 44.1/48kHz in 2x/4x sessions (adds latency)
+    // ============================================================================
+    params.push_back (std::make_unique<juce::AudioParameterBool> (
+        "ecoMode", "Eco Mode", false,
+        juce::AudioParameterBoolAttributes().withAutomatable (false)));
+
+    // Float variants of the Airwindows ports (~130-145dB null against double,
+    // ToTape8 ~100dB)
+    params.push_back (std::make_unique<juce::AudioParameterBool> (
+        "ecoPrecision", "Eco Precision", false,
+        juce::AudioParameterBoolAttributes().withAutomatable (false)));
+
+    // ============================================================================
+    // MULTICORE - L and R on two threads while no stereo link couples them
+    // ============================================================================
+    params.push_back (std::make_unique<juce::AudioParameterBool> (
+        "multicore", "Multicore", false,
+        juce::AudioParameterBoolAttributes().withAutomatable (false)));
+
+    // ============================================================================
+    // DETECTORS WHILE BYPASSED - compressor envelopes keep tracking the input
+    // ============================================================================
+    params.push_back (std::make_unique<juce::AudioParameterBool> (
+        "detectorsWhileBypassed", "Detectors While Bypassed", true,
+        juce::AudioParameterBoolAttributes().withAutomatable (false)));
+
+    // ============================================================================
+    // HOST BYPASS (exposed to the host via getBypassParameter)
+    // ============================================================================
+    params.push_back (std::make_unique<juce::AudioParameterBool> (
+        "hostBypass", "Bypass", false));
+
     // ============================================================================
     // GUI: Zoom Preference - MOVED TO PropertiesFile (global setting)
     // ============================================================================
     // NOTE: guiZoom parameter removed from APVTS (was causing issues in Logic Pro)
     // Now saved globally in PropertiesFile instead of per-project in APVTS
-    // Migration code in constructor handles existing users seamlessly
+    // Migration code in setStateInformation() handles existing users seamlessly
 
     return { params.begin(), params.end() };
 }
@@ -916,21 +1394,57 @@ juce::AudioProcessorValueTreeState::ParameterLayout AnalogChannelAudioProcessor:
 // GUI Settings Management
 //==============================================================================
 
-int AnalogChannelAudioProcessor::getGuiZoom() const
+juce::PropertiesFile& AnalogChannelAudioProcessor::getGuiSettings() const
 {
-    if (guiSettings != nullptr)
-        return guiSettings->getIntValue ("guiZoom", 2); // Default: 125% (index 2)
+    // Callers hold guiSettingsLock
+    if (guiSettings == nullptr)
+    {
+        guiSettings = std::make_unique<juce::PropertiesFile> (guiSettingsOptions);
+
+        if (pendingGuiZoomMigration >= 0)
+        {
+            // Apply zoom migrated from an old project loaded before the editor was opened
+            guiSettings->setValue ("guiZoom", pendingGuiZoomMigration);
+            guiSettings->saveIfNeeded();
+            pendingGuiZoomMigration = -1;
+        }
+        else if (!guiSettings->containsKey ("guiZoom"))
+        {
+            // Set default guiZoom if not already set (first time user)
+            guiSettings->setValue ("guiZoom", 2); // Default: 125% (index 2)
+            guiSettings->saveIfNeeded();
+        }
+    }
+
+    return *guiSettings;
+}
 
-    return 2; // Fallback default
+int AnalogChannelAudioProcessor::getGuiZoom() const
+{
+    const juce::ScopedLock sl (guiSettingsLock);
+    return getGuiSettings().getIntValue ("guiZoom", 2); // Default: 125% (index 2)
 }
 
 void AnalogChannelAudioProcessor::setGuiZoom (int zoomIndex)
 {
-    if (guiSettings != nullptr)
-    {
-        guiSettings->setValue ("guiZoom", zoomIndex);
-        guiSettings->saveIfNeeded();
-    }
+    const juce::ScopedLock sl (guiSettingsLock);
+    auto& settings = getGuiSettings();
+    settings.setValue ("guiZoom", zoomIndex);
+    settings.saveIfNeeded();
+}
+
+bool AnalogChannelAudioProcessor::getShowAnalyser() const
+{
+    const juce::ScopedLock sl (guiSettingsLock);
+    return getGuiSettings().getBoolValue ("showAnalyser", false);
+}
+
+void AnalogChannelAudioProcessor::setShowAnalyser (bool shouldShow)
+{
+    const juce::ScopedLock sl (guiSettingsLock);
+    auto& settings = getGuiSettings();
+    settings.setValue ("showAnalyser", shouldShow);
+    settings.saveIfNeeded();
 }
 
 //==============================================================================
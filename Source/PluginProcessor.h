@@ -39,12 +39,21 @@
 #include "Sections/ConsoleSection.h"
 #include "Sections/OutStageSection.h"
 #include "Sections/VolumeSection.h"
+#include "Algorithms/PolyphaseResampler.h"
+#include "BlockKernels.h"
 #include "ChannelVariation.h"
+#include "ParameterEventQueue.h"
+#include "ParameterSnapshot.h"
+#include "ScratchArena.h"
+#include "SpectrumAnalyser.h"
+#include "WorkerPool.h"
 
 //==============================================================================
 /**
 */
-class AnalogChannelAudioProcessor  : public juce::AudioProcessor
+class AnalogChannelAudioProcessor  : public juce::AudioProcessor,
+                                     private juce::AudioProcessorValueTreeState::Listener,
+                                     private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -54,12 +63,18 @@ public:
     //==============================================================================
     void prepareToPlay (double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
+    void setNonRealtime (bool isNonRealtime) noexcept override;
 
    #ifndef JucePlugin_PreferredChannelConfigurations
     bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
+    juce::AudioProcessorParameter* getBypassParameter() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -109,6 +124,19 @@ public:
     // GUI Settings Access
     int getGuiZoom() const;
     void setGuiZoom (int zoomIndex);
+    bool getShowAnalyser() const;
+    void setShowAnalyser (bool shouldShow);
+
+    //==============================================================================
+    // Spectrum analyser (chain input and output; idle unless an editor shows it)
+    SpectrumAnalyser& getSpectrumAnalyser() { return spectrumAnalyser; }
+
+    // Rate the sections run at (host rate / eco factor), for the GUI's response curves
+    double getProcessingSampleRate() const { return processingSampleRate.load(); }
+
+    //==============================================================================
+    // Per-instance memory (processor object plus allocated algorithm state)
+    size_t getInstanceStateBytes() const;
 
 private:
     //==============================================================================
@@ -118,13 +146,136 @@ private:
     // Helper function to create all parameters
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
-    // Update all sections with current parameter values
+    // Update all sections with current parameter values (once per block)
     void updateAllSections();
 
+    // Per-block parameter snapshot: changes arrive as events (any thread) and
+    // are drained at block start; the atomics are looked up once, for resyncs
+    ParameterSnapshot::Sources parameterSources {};
+    ParameterSnapshot parameterSnapshot;           // Audio thread (and prepareToPlay)
+    ParameterEventQueue parameterEvents;
+
+    //==============================================================================
+    // Processing
+    // Host bypass: a 10ms crossfade, then pass-through at (almost) zero cost.
+    // Templated on the host sample type: double hosts run the chain in double
+    // (sections with float-only DSP convert at their boundary).
+    template <typename SampleType>
+    void processBlockWithHostBypass (juce::AudioBuffer<SampleType>& buffer, bool shouldBypass);
+    template <typename SampleType>
+    void processChain (juce::AudioBuffer<SampleType>& buffer);
+
+    // Large host blocks (bounces hand over 8192+ samples) run through the
+    // chain in chunks of this size: two channels of doubles stay in L1, and
+    // section state stays hot from one section to the next. Meters still
+    // update once per block, and bypass fades keep their 10ms length (the
+    // sections carry the ramp from one chunk to the next).
+    static constexpr int chainChunkSize = 256;
+    void decayMetersForBypass (int numSamples);
+
+    // Pre-warming (end of prepareToPlay): one silent block through the whole
+    // chain touches every active section's state and builds its coefficients,
+    // then the state is reset so playback still starts clean
+    template <typename SampleType>
+    void primeProcessingChain (int numSamples);
+    void resetProcessingState();
+
+    juce::AudioParameterBool* hostBypass = nullptr;
+    int hostBypassFadeSamples = 441;                // 10ms
+    int hostBypassWetPosition = 441;                // Audio thread: 0 = bypassed, hostBypassFadeSamples = processing
+
+    // Dry copy for the crossfade, sized in prepareToPlay (crossfade length,
+    // both precisions)
+    std::tuple<juce::AudioBuffer<float>, juce::AudioBuffer<double>> hostBypassDryBuffers;
+
+    //==============================================================================
+    // Eco Mode
+    // At 2x/4x session rates the chain can run at 44.1/48kHz (the rate the
+    // Airwindows ports were designed for) between a polyphase decimator and
+    // interpolator. The filter delay is reported as latency, and the dry path
+    // (host bypass) is delayed to match.
+    template <typename SampleType>
+    void processChainAtInternalRate (juce::AudioBuffer<SampleType>& buffer);
+    bool isOptionSet (ParameterSnapshot::Field field) const;
+    bool isEcoModeRequested() const;
+    void updateEcoMode();
+
+    // The part of prepareToPlay that depends on the processing rate: eco
+    // resamplers, dry delay, scratch, sections, meters (then primed).
+    // prepareToPlay, or updateEcoMode() with processing suspended.
+    void prepareProcessingRate (double sampleRate, int newEcoFactor);
+    static int getEcoResamplingFactor (double sampleRate);
+
+    // Eco precision: the Airwindows saturators, consoles and shelves switch to
+    // their float variants (crossfaded like an algorithm change). Independent
+    // of the rate above; no latency.
+    bool isEcoPrecisionRequested() const;
+
+    //==============================================================================
+    // Multicore
+    // Optional worker pool: while no stereo-linked stage couples them, L and R
+    // each run the whole chain as one task, one of them on a worker thread
+    // (see WorkerPool.h). Off by default - a worker spins for most of a
+    // block period after each block.
+    // Offline renders (isNonRealtime()) always get the worker, and split
+    // large blocks even with the parameter off: nothing waits on a deadline
+    // there, so the only cost is the second core.
+    bool isMulticoreRequested() const;
+    void updateMulticore();
+    void prepareWorkerPool (double sampleRate, int samplesPerBlock);
+    bool shouldProcessChannelsInParallel (int numSamples) const;
+    static constexpr int minSamplesForParallelChannels = 32;            // Below this the handoff costs more than it saves
+    static constexpr int minSamplesForOfflineParallelChannels = 1024;   // Offline: only blocks where the split clearly pays
+
+    WorkerPool workerPool;
+    bool isMulticoreEnabled = false;                // Parameter state the pool was prepared for
+
+    int ecoFactor = 1;                              // Host rate / processing rate (1 = off)
+    int ecoMaxBlockSize = 512;                      // Host samples per resampled chunk
+    PolyphaseResampler ecoResamplers[2];
+    LatencyCompensationDelay dryDelays[2];
+    juce::AudioBuffer<float> ecoInternalBuffer;     // Processing-rate block (refers to the scratch arena)
+
+    //==============================================================================
+    // Scratch Memory
+    // Audio-thread scratch buffers in one cache-line aligned arena, laid out in
+    // prepareToPlay from the announced block size and the eco factor (see
+    // ScratchArena.h): the eco resampling blocks and each section's scratch.
+    // Debug builds assert when a host sends more samples than announced.
+    void prepareScratchArena();
+
+    ScratchArena scratchArena;
+    int maxBlockSize = 0;                           // samplesPerBlock from prepareToPlay
+    std::atomic<double> processingSampleRate { 44100.0 };
+
+    SpectrumAnalyser spectrumAnalyser;
+
+    //==============================================================================
+    // Algorithm State Allocation
+    // Only the selected algorithm of each multi-algorithm section holds state.
+    // Algorithm changes are picked up here (message thread) and the new state is
+    // allocated before the audio thread switches to it (see AlgorithmStateSlot.h).
+    // Offline renders hold every algorithm's state in the current precision,
+    // allocated by the prepareToPlay or async update that follows
+    // setNonRealtime(); neither setNonRealtime nor processBlock allocates.
+    void parameterChanged (const juce::String& parameterID, float newValue) override;
+    void handleAsyncUpdate() override;
+    void updateAlgorithmStates();
+    bool sectionsNeedAlgorithmStateUpdate();
+
     //==============================================================================
     // GUI Settings Management (saved globally, not per-project)
+    // The PropertiesFile is opened lazily on first editor access, so plugin
+    // scans and headless session loads never touch the disk.
+    // The editor (message thread) and setStateInformation (any thread the
+    // host restores state on) both reach it: everything below is guarded by
+    // guiSettingsLock, and getGuiSettings() is called with it held.
+    juce::PropertiesFile& getGuiSettings() const;
+
     juce::PropertiesFile::Options guiSettingsOptions;
-    std::unique_ptr<juce::PropertiesFile> guiSettings;
+    mutable juce::CriticalSection guiSettingsLock;
+    mutable std::unique_ptr<juce::PropertiesFile> guiSettings;
+    mutable int pendingGuiZoomMigration = -1;  // Zoom migrated from an old project, written on first open
 
     //==============================================================================
     // Processing Sections - Dual Mono (index 0 = left, 1 = right)
@@ -158,13 +309,29 @@ private:
     float inputPeakStateRight = 0.0f;
     float outputPeakStateLeft = 0.0f;
     float outputPeakStateRight = 0.0f;
-    float outStageInputRMSLeft = 0.0f;
-    float outStageInputRMSRight = 0.0f;
-    float outStageOutputRMSLeft = 0.0f;
-    float outStageOutputRMSRight = 0.0f;
+
+    // OutStage RMS sums, accumulated inside the per-channel chain. With the
+    // channels on two threads each channel's pair is written by a different
+    // core, so each gets its own cache line. (The meter atomics above are only
+    // stored by the calling thread, after both channels are done.)
+    struct alignas (64) OutStageRMS
+    {
+        float input = 0.0f;
+        float output = 0.0f;
+    };
+
+    OutStageRMS outStageRMS[2];
     float outStageGRSmoothLeft = 0.0f;
     float outStageGRSmoothRight = 0.0f;
 
+    // Block metering helpers
+    template <typename SampleType>
+    void updatePeakMeter (const SampleType* data, int numSamples, float& peakState) const;
+    static float getPeak (const float* data, int numSamples);
+    static float getPeak (const double* data, int numSamples);
+    static float getSumOfSquares (const float* data, int numSamples);
+    static float getSumOfSquares (const double* data, int numSamples);
+
     // Metering coefficients (calculated in prepareToPlay)
     float peakDecayCoeff = 0.0f;
     float outStageAttackCoeff = 0.0f;
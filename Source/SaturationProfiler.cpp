@@ -0,0 +1,289 @@
+/*
+  ==============================================================================
+
+    SaturationProfiler.cpp
+    Transfer curve and harmonic profile of the saturation stages, measured
+    offline for the editor
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "SaturationProfiler.h"
+
+//==============================================================================
+class SaturationProfiler::ProfilingThread : public juce::Thread
+{
+public:
+    explicit ProfilingThread (SaturationProfiler& owner)
+        : juce::Thread ("AnalogChannel saturation profiler"), profiler (owner)
+    {
+    }
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            if (! profiler.measureNextRequest())
+                wait (-1);
+        }
+    }
+
+private:
+    SaturationProfiler& profiler;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProfilingThread)
+};
+
+//==============================================================================
+namespace
+{
+    /**
+        Points a private section at the key's algorithm and drive. Switching
+        algorithm starts the section's crossfade: the reset cuts it short, so
+        the state it replaced can be freed straight away.
+    */
+    template <typename SectionType>
+    void selectAlgorithm (SectionType& section, const SaturationProfiler::Key& key)
+    {
+        using Algorithm = typename SectionType::Algorithm;
+        const auto algorithm = static_cast<Algorithm> (juce::jlimit (0, static_cast<int> (SectionType::NumAlgorithms) - 1, key.algorithm));
+
+        section.setEcoPrecision (key.ecoPrecision);
+        section.updateAlgorithmStates (algorithm, key.ecoPrecision);
+        section.setAlgorithm (algorithm);
+        section.setDrive (key.getDriveDecibels());
+
+        section.reset();
+        section.updateAlgorithmStates (algorithm, key.ecoPrecision);
+    }
+}
+
+//==============================================================================
+SaturationProfiler::SaturationProfiler()
+{
+    cache.reserve (cacheSize);
+
+    thread = std::make_unique<ProfilingThread> (*this);
+    thread->startThread();
+}
+
+SaturationProfiler::~SaturationProfiler()
+{
+    // Stops between two levels at the latest
+    thread->stopThread (2000);
+}
+
+SaturationProfiler::ProfilePtr SaturationProfiler::requestProfile (const Key& key)
+{
+    const juce::ScopedLock sl (lock);
+    auto profile = findCached (key);
+
+    if (isRunning && running == key)
+    {
+        // Back to the profile being measured: drop the request it would yield to
+        hasPending[key.stage] = false;
+    }
+    else if (profile == nullptr || ! profile->isComplete())
+    {
+        pending[key.stage] = key;
+        hasPending[key.stage] = true;
+        thread->notify();
+    }
+
+    return profile;
+}
+
+//==============================================================================
+bool SaturationProfiler::measureNextRequest()
+{
+    Key key;
+    ProfilePtr cached;
+
+    {
+        const juce::ScopedLock sl (lock);
+        int stage = 0;
+
+        while (stage < NumStages && ! hasPending[stage])
+            ++stage;
+
+        if (stage == NumStages)
+            return false;
+
+        key = pending[stage];
+        hasPending[stage] = false;
+        running = key;
+        isRunning = true;
+        cached = findCached (key);
+    }
+
+    // A partial profile is completed, not started over
+    Profile profile = cached != nullptr ? *cached : Profile();
+    profile.key = key;
+
+    if (profile.isComplete())
+    {
+        const juce::ScopedLock sl (lock);
+        isRunning = false;
+        return true;
+    }
+
+    auto& section = prepareSection (key);
+
+    for (int level = profile.numLevelsMeasured; level < numLevels; ++level)
+    {
+        measureLevel (section, profile, level);
+        profile.numLevelsMeasured = level + 1;
+
+        const juce::ScopedLock sl (lock);
+        storeProfile (profile);
+
+        if (hasPending[key.stage] || juce::Thread::currentThreadShouldExit() || profile.isComplete())
+        {
+            isRunning = false;
+            break;
+        }
+    }
+
+    return true;
+}
+
+BypassableSection& SaturationProfiler::prepareSection (const Key& key)
+{
+    auto prepare = [&] (auto& section) -> BypassableSection&
+    {
+        if (preparedRates[key.stage] != key.sampleRate)
+        {
+            section.setSampleRate (key.sampleRate);
+            preparedRates[key.stage] = key.sampleRate;
+        }
+
+        selectAlgorithm (section, key);
+        return section;
+    };
+
+    switch (key.stage)
+    {
+        case Console:  return prepare (console);
+        case OutStage: return prepare (outStage);
+        default:       return prepare (preInput);
+    }
+}
+
+void SaturationProfiler::measureLevel (BypassableSection& section, Profile& profile, int level)
+{
+    constexpr int blockSize = 512;
+    const double sampleRate = profile.key.sampleRate;
+    const int settleLength = juce::roundToInt (settleSeconds * sampleRate);
+    const int totalLength = settleLength + analysisLength;
+
+    // Whole cycles in the analysis window put every harmonic on one DFT bin
+    // (no window needed); the 8th harmonic stays below Nyquist
+    const int cycles = juce::jlimit (1, analysisLength / (2 * (numHarmonics + 1)) - 1,
+                                     juce::roundToInt (analysisLength * testFrequency / sampleRate));
+    const double phaseIncrement = juce::MathConstants<double>::twoPi * cycles / analysisLength;
+    const double amplitude = juce::Decibels::decibelsToGain (static_cast<double> (levelDecibels[level]));
+
+    signal.resize (static_cast<size_t> (totalLength));
+
+    for (int i = 0; i < totalLength; ++i)
+        signal[static_cast<size_t> (i)] = amplitude * std::sin (phaseIncrement * i);
+
+    section.reset();
+
+    for (int offset = 0; offset < totalLength; offset += blockSize)
+        section.processBlock (signal.data() + offset, juce::jmin (blockSize, totalLength - offset));
+
+    const double* output = signal.data() + settleLength;
+
+    // Static transfer curve from the 0dBFS level: mean output per input bin
+    if (level == 0)
+    {
+        std::array<double, numCurvePoints> sums {};
+        std::array<int, numCurvePoints> counts {};
+
+        for (int i = 0; i < analysisLength; ++i)
+        {
+            const double input = std::sin (phaseIncrement * (settleLength + i));
+            const auto point = static_cast<size_t> (juce::roundToInt ((input + 1.0) * 0.5 * (numCurvePoints - 1)));
+            sums[point] += output[i];
+            ++counts[point];
+        }
+
+        for (size_t point = 0; point < sums.size(); ++point)
+        {
+            if (counts[point] > 0)
+                profile.transferCurve[point] = static_cast<float> (sums[point] / counts[point]);
+            else
+                profile.transferCurve[point] = point > 0 ? profile.transferCurve[point - 1] : 0.0f;
+        }
+    }
+
+    // Goertzel at the fundamental and harmonic bins
+    auto getAmplitude = [&] (int bin)
+    {
+        const double coefficient = 2.0 * std::cos (juce::MathConstants<double>::twoPi * bin / analysisLength);
+        double s1 = 0.0, s2 = 0.0;
+
+        for (int i = 0; i < analysisLength; ++i)
+        {
+            const double s0 = output[i] + coefficient * s1 - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        const double power = s1 * s1 + s2 * s2 - coefficient * s1 * s2;
+        return 2.0 * std::sqrt (juce::jmax (0.0, power)) / analysisLength;
+    };
+
+    const double fundamental = getAmplitude (cycles);
+    profile.fundamentalGainDecibels[level] = static_cast<float> (juce::Decibels::gainToDecibels (fundamental / amplitude, static_cast<double> (minDecibels)));
+
+    for (int harmonic = 0; harmonic < numHarmonics; ++harmonic)
+    {
+        const double relative = fundamental > 0.0 ? getAmplitude (cycles * (harmonic + 2)) / fundamental : 0.0;
+        profile.harmonicDecibels[level][harmonic] = static_cast<float> (juce::Decibels::gainToDecibels (relative, static_cast<double> (minDecibels)));
+    }
+}
+
+//==============================================================================
+SaturationProfiler::ProfilePtr SaturationProfiler::findCached (const Key& key)
+{
+    for (auto& entry : cache)
+    {
+        if (entry.profile->key == key)
+        {
+            entry.lastUsed = ++useCounter;
+            return entry.profile;
+        }
+    }
+
+    return nullptr;
+}
+
+void SaturationProfiler::storeProfile (const Profile& profile)
+{
+    auto stored = std::make_shared<const Profile> (profile);
+
+    for (auto& entry : cache)
+    {
+        if (entry.profile->key == profile.key)
+        {
+            entry = { std::move (stored), ++useCounter };
+            return;
+        }
+    }
+
+    if (cache.size() < static_cast<size_t> (cacheSize))
+    {
+        cache.push_back ({ std::move (stored), ++useCounter });
+        return;
+    }
+
+    // Full: replace the least recently used profile
+    auto oldest = std::min_element (cache.begin(), cache.end(),
+                                    [] (const CacheEntry& a, const CacheEntry& b) { return a.lastUsed < b.lastUsed; });
+    *oldest = { std::move (stored), ++useCounter };
+}
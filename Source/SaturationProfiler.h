@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+    SaturationProfiler.h
+    Transfer curve and harmonic profile of the saturation stages, measured
+    offline for the editor
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    A background thread runs private PreInput / Console / OutStage sections -
+    the chain's own code, so PurestDrive, ToTape8, Tube2, Channel8Console,
+    FinalClip and ClipSoftly with the sections' drive staging - over a
+    coherent sine at a few levels. The loudest level gives the static transfer
+    curve (output binned by input value, which averages out the hysteresis of
+    the filtered algorithms), every level its harmonics. The processor's
+    sections are never touched.
+
+    Profiles are cached by (stage, algorithm, precision, drive, sample rate).
+    Levels are measured loudest first and published one at a time, and a
+    measurement yields to a newer request for the same stage between levels:
+    a drive drag follows the latest value within one level, and whatever an
+    abandoned profile is missing is measured if it is requested again.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Sections/PreInputSection.h"
+#include "Sections/ConsoleSection.h"
+#include "Sections/OutStageSection.h"
+#include <array>
+#include <memory>
+#include <vector>
+
+//==============================================================================
+class SaturationProfiler
+{
+public:
+    enum Stage
+    {
+        PreInput,
+        Console,
+        OutStage,
+        NumStages
+    };
+
+    static constexpr int numLevels = 4;
+    static constexpr float levelDecibels[numLevels] { 0.0f, -6.0f, -12.0f, -18.0f };  // Peak dBFS, measured in this order
+    static constexpr int numHarmonics = 7;                                             // 2nd to 8th
+    static constexpr int numCurvePoints = 33;                                          // Inputs -1 to 1
+    static constexpr float driveResolutionDecibels = 0.1f;
+    static constexpr float minDecibels = -120.0f;
+
+    //==============================================================================
+    struct Key
+    {
+        Stage stage = PreInput;
+        int algorithm = 0;
+        bool ecoPrecision = false;
+        int driveSteps = 0;            // Drive in driveResolutionDecibels steps
+        double sampleRate = 44100.0;
+
+        float getDriveDecibels() const { return static_cast<float> (driveSteps) * driveResolutionDecibels; }
+
+        bool operator== (const Key& other) const
+        {
+            return stage == other.stage && algorithm == other.algorithm && ecoPrecision == other.ecoPrecision
+                && driveSteps == other.driveSteps && sampleRate == other.sampleRate;
+        }
+
+        bool operator!= (const Key& other) const { return ! operator== (other); }
+    };
+
+    static Key makeKey (Stage stage, int algorithm, bool ecoPrecision, float driveDecibels, double sampleRate)
+    {
+        return { stage, algorithm, ecoPrecision, juce::roundToInt (driveDecibels / driveResolutionDecibels), sampleRate };
+    }
+
+    struct Profile
+    {
+        Key key;
+        int numLevelsMeasured = 0;
+
+        std::array<float, numCurvePoints> transferCurve {};   // Output at inputs -1 to 1 (0dBFS level)
+        float fundamentalGainDecibels[numLevels] {};          // Output / input at the test frequency
+        float harmonicDecibels[numLevels][numHarmonics] {};   // Relative to the fundamental
+
+        bool isComplete() const { return numLevelsMeasured == numLevels; }
+    };
+
+    using ProfilePtr = std::shared_ptr<const Profile>;
+
+    SaturationProfiler();
+    ~SaturationProfiler();
+
+    //==============================================================================
+    /**
+        Message thread: returns the cached profile for key (it may still be
+        missing levels; nullptr if nothing was measured yet) and queues the
+        measurement of whatever is missing. A request replaces any earlier one
+        for the same stage that hasn't started.
+    */
+    ProfilePtr requestProfile (const Key& key);
+
+private:
+    //==============================================================================
+    class ProfilingThread;
+
+    static constexpr int cacheSize = 64;
+    static constexpr int analysisLength = 8192;          // Whole cycles of the test sine
+    static constexpr double testFrequency = 1000.0;      // Approximate: rounded to whole cycles
+    static constexpr double settleSeconds = 0.05;
+
+    struct CacheEntry
+    {
+        ProfilePtr profile;
+        uint32_t lastUsed = 0;
+    };
+
+    // Profiling thread
+    bool measureNextRequest();
+    BypassableSection& prepareSection (const Key& key);
+    void measureLevel (BypassableSection& section, Profile& profile, int level);
+
+    // Call with the lock held
+    ProfilePtr findCached (const Key& key);
+    void storeProfile (const Profile& profile);
+
+    //==============================================================================
+    juce::CriticalSection lock;
+    std::vector<CacheEntry> cache;
+    uint32_t useCounter = 0;
+    Key pending[NumStages];
+    bool hasPending[NumStages] {};
+    Key running;
+    bool isRunning = false;
+
+    // Profiling thread only
+    PreInputSection preInput;
+    ConsoleSection console;
+    OutStageSection outStage;
+    double preparedRates[NumStages] {};
+    std::vector<double> signal;
+
+    std::unique_ptr<ProfilingThread> thread;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SaturationProfiler)
+};
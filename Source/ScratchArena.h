@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    ScratchArena.h
+    Per-instance scratch memory, laid out and allocated in prepareToPlay
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    One zeroed allocation holds every scratch buffer the processor and its
+    sections use on the audio thread (resampler blocks, dry copies, ...).
+    prepareToPlay reserves regions from the maximum block size and the
+    resampling factor, allocates once, then hands out the pointers. Each
+    region starts on its own cache line. The audio thread only uses the
+    pointers: nothing is allocated, resized or freed while processing.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <cstddef>
+#include <cstdint>
+
+//==============================================================================
+class ScratchArena
+{
+public:
+    static constexpr std::size_t alignment = 64;  // Cache line
+
+    /** A reserved range (valid once allocate() has run). */
+    struct Region
+    {
+        std::size_t offset = 0;
+        std::size_t numBytes = 0;
+    };
+
+    ScratchArena() = default;
+
+    //==============================================================================
+    /** Drops all regions and the memory (message thread, processing stopped). */
+    void clear()
+    {
+        memory.free();
+        data = nullptr;
+        numBytesReserved = 0;
+    }
+
+    /** Reserves numElements of T; call allocate() once every region is reserved. */
+    template <typename T>
+    Region reserve (int numElements)
+    {
+        jassert (data == nullptr);  // Layout is fixed once allocated
+
+        Region region { numBytesReserved, sizeof (T) * static_cast<std::size_t> (juce::jmax (0, numElements)) };
+        numBytesReserved += roundUpToAlignment (region.numBytes);
+        return region;
+    }
+
+    /** One zeroed, cache-line aligned allocation for all reserved regions. */
+    void allocate()
+    {
+        memory.allocate (numBytesReserved + alignment, true);
+
+        const auto address = reinterpret_cast<std::uintptr_t> (memory.get());
+        data = memory.get() + (roundUpToAlignment (address) - address);
+    }
+
+    template <typename T>
+    T* get (Region region) const
+    {
+        jassert (data != nullptr && region.offset + region.numBytes <= numBytesReserved);
+        return region.numBytes > 0 ? reinterpret_cast<T*> (data + region.offset) : nullptr;
+    }
+
+    std::size_t getNumBytes() const { return numBytesReserved; }
+
+private:
+    static constexpr std::size_t roundUpToAlignment (std::size_t value)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    juce::HeapBlock<char> memory;
+    char* data = nullptr;
+    std::size_t numBytesReserved = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ScratchArena)
+};
@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    AlgorithmCrossfader.h
+    Click-free switching between the algorithms of a multi-algorithm section
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    When the algorithm changes, the incoming algorithm is reset and pre-warmed
+    by running it over the last few milliseconds of section input (output is
+    discarded), so its filters, envelopes and saturation state match the
+    signal. Then the outgoing and incoming algorithms run side by side for a
+    short equal-gain crossfade, after which only the incoming one runs.
+
+    Cost: one pre-warm burst (prewarmTimeSeconds of one algorithm) plus two
+    algorithms for fadeTimeSeconds - never more than two algorithms at once.
+
+    The input history is written every sample but read only on a change, so
+    it lives in its own allocation (sized in setSampleRate to the pre-warm
+    span) rather than inside the section object next to the per-sample state.
+    Construction allocates nothing: until setSampleRate() the history is a
+    single sample and there is no pre-warm.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Input history and crossfade ramp shared by the multi-algorithm sections.
+    Audio thread only - no allocation, no locks.
+*/
+class AlgorithmCrossfader
+{
+public:
+    static constexpr float fadeTimeSeconds = 0.01f;     // 10ms, same as bypass fade
+    static constexpr float prewarmTimeSeconds = 0.005f; // 5ms of input history
+    static constexpr int maxHistorySize = 1024;         // Covers 5ms up to 192kHz (power of two)
+
+    AlgorithmCrossfader() = default;
+
+    //==============================================================================
+    /**
+        Changes the ramp and history lengths (stops a running fade). May
+        reallocate the history: message thread / prepareToPlay only.
+    */
+    void setSampleRate (double sampleRate)
+    {
+        fadeSamples = juce::jmax (1, juce::roundToInt (sampleRate * fadeTimeSeconds));
+        prewarmSamples = juce::jlimit (0, maxHistorySize, juce::roundToInt (sampleRate * prewarmTimeSeconds));
+        fadePosition = fadeSamples;
+
+        // Power of two holding the pre-warm span: 256 samples (1KB) at 44.1/48kHz
+        const int newHistorySize = juce::nextPowerOfTwo (juce::jmax (1, prewarmSamples));
+
+        if (newHistorySize != historySize)
+        {
+            historyStorage.calloc (static_cast<size_t> (newHistorySize));
+            history = historyStorage.get();
+            historySize = newHistorySize;
+            writePosition = 0;
+        }
+    }
+
+    void reset()
+    {
+        std::fill (history, history + historySize, 0.0f);
+        writePosition = 0;
+        fadePosition = fadeSamples;
+    }
+
+    /** Heap memory held for the input history. */
+    size_t getHistoryBytes() const { return historyStorage != nullptr ? sizeof (float) * static_cast<size_t> (historySize) : 0; }
+
+    //==============================================================================
+    /** Records one sample of section input (call for every processed sample). */
+    void pushInput (float input)
+    {
+        history[writePosition] = input;
+        writePosition = (writePosition + 1) & (historySize - 1);
+    }
+
+    /**
+        Runs the given processing function over the recent input history,
+        oldest sample first. Used to settle a freshly reset algorithm.
+    */
+    template <typename ProcessFunction>
+    void prewarm (ProcessFunction&& processSample) const
+    {
+        int readPosition = (writePosition - prewarmSamples) & (historySize - 1);
+
+        for (int i = 0; i < prewarmSamples; ++i)
+        {
+            processSample (history[readPosition]);
+            readPosition = (readPosition + 1) & (historySize - 1);
+        }
+    }
+
+    //==============================================================================
+    void startFade() { fadePosition = 0; }
+    void stopFade() { fadePosition = fadeSamples; }
+    bool isFading() const { return fadePosition < fadeSamples; }
+
+    /**
+        Mixes one sample of the outgoing and incoming algorithms and advances the ramp.
+        Equal-gain (linear) law: both algorithms see the same input, so their
+        outputs are strongly correlated and sum without a level dip.
+    */
+    template <typename SampleType>
+    SampleType mix (SampleType outgoing, SampleType incoming)
+    {
+        ++fadePosition;
+        const auto incomingGain = static_cast<SampleType> (fadePosition) / static_cast<SampleType> (fadeSamples);
+        return outgoing + (incoming - outgoing) * incomingGain;
+    }
+
+private:
+    int writePosition = 0;
+    int prewarmSamples = 0;
+    int fadeSamples = 441;
+    int fadePosition = 441;
+    int historySize = 1;
+    float unpreparedHistory = 0.0f;         // Until setSampleRate() allocates
+    float* history = &unpreparedHistory;
+    juce::HeapBlock<float> historyStorage;
+
+    JUCE_DECLARE_NON_COPYABLE (AlgorithmCrossfader)
+};
@@ -0,0 +1,424 @@
+/*
+  ==============================================================================
+
+    AlgorithmStateSlot.h
+    Lazily allocated per-algorithm state for multi-algorithm sections
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    Sections like Pre-Input, Console, Style-Comp and Out Stage offer several
+    algorithms but only ever run one of them. Instead of embedding every
+    algorithm object, each section keeps one slot per algorithm and only the
+    selected algorithm's state is allocated.
+
+    Threading model (lock-free handover):
+    - The message thread allocates and frees slot state (allocate()/free()).
+    - The audio thread claims the state it runs (acquire()/release()).
+    - Each slot is a small atomic state machine, so a slot is never freed
+      while the audio thread holds it, and never handed to the audio thread
+      while it is being created or destroyed.
+
+    Algorithm changes are crossfaded (see AlgorithmCrossfader.h): the outgoing
+    algorithm stays claimed by the audio thread until the fade has finished.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "AlgorithmCrossfader.h"
+#include "../Algorithms/DenormalPolicy.h"
+#include <array>
+#include <atomic>
+#include <functional>
+
+//==============================================================================
+/**
+    Type-independent part of an algorithm state slot (the handover state machine).
+*/
+class AlgorithmStateSlotBase
+{
+public:
+    AlgorithmStateSlotBase() = default;
+    virtual ~AlgorithmStateSlotBase() = default;
+
+    //==============================================================================
+    // Message thread (or prepareToPlay, while the audio thread is stopped)
+
+    /**
+        Creates and prepares the algorithm state if it doesn't exist yet.
+        @return true if the state is available afterwards
+    */
+    bool allocate()
+    {
+        int expected = Empty;
+        if (state.compare_exchange_strong (expected, Busy))
+        {
+            createState();
+            state.store (Ready);
+            return true;
+        }
+
+        return expected == Ready || expected == InUse;
+    }
+
+    /**
+        Destroys the algorithm state unless the audio thread is currently using it.
+        @return true if the slot is empty afterwards
+    */
+    bool free()
+    {
+        int expected = Ready;
+        if (state.compare_exchange_strong (expected, Busy))
+        {
+            destroyState();
+            state.store (Empty);
+            return true;
+        }
+
+        return expected == Empty;
+    }
+
+    bool isAllocated() const
+    {
+        const int current = state.load();
+        return current == Ready || current == InUse;
+    }
+
+    /** Heap bytes held by this slot (0 when empty). */
+    size_t getAllocatedBytes() const
+    {
+        return isAllocated() ? getStateBytes() : 0;
+    }
+
+    //==============================================================================
+    // Audio thread
+
+    /**
+        Claims the state for processing. Never blocks or allocates.
+        @return false if the state isn't allocated (yet)
+    */
+    bool acquire()
+    {
+        int expected = Ready;
+        return state.compare_exchange_strong (expected, InUse) || expected == InUse;
+    }
+
+    /** Hands the state back so the message thread may free it. */
+    void release()
+    {
+        int expected = InUse;
+        state.compare_exchange_strong (expected, Ready);
+    }
+
+protected:
+    virtual void createState() = 0;
+    virtual void destroyState() = 0;
+    virtual size_t getStateBytes() const = 0;
+
+private:
+    enum SlotState
+    {
+        Empty = 0,  // No state allocated
+        Ready = 1,  // Allocated, not used by the audio thread
+        InUse = 2,  // Claimed by the audio thread
+        Busy = 3    // Being created/destroyed by the message thread
+    };
+
+    std::atomic<int> state { Empty };
+
+    JUCE_DECLARE_NON_COPYABLE (AlgorithmStateSlotBase)
+};
+
+//==============================================================================
+/**
+    Slot holding the state of one algorithm type.
+    The prepare function configures a freshly created (or re-prepared) instance,
+    e.g. sample rate, console type or PRNG seed.
+*/
+template <typename AlgorithmType>
+class AlgorithmStateSlot : public AlgorithmStateSlotBase
+{
+public:
+    /**
+        @param prepareFunction configures the algorithm after creation and on sample rate changes
+        @param extraHeapBytes heap memory owned by the algorithm itself (for the memory report)
+    */
+    explicit AlgorithmStateSlot (std::function<void (AlgorithmType&)> prepareFunction,
+                                 size_t extraHeapBytes = 0)
+        : prepare (std::move (prepareFunction)), heapBytes (extraHeapBytes)
+    {
+    }
+
+    ~AlgorithmStateSlot() override = default;
+
+    /** Only valid while acquired by the audio thread, or during prepareToPlay. */
+    AlgorithmType* get() const noexcept { return algorithm.get(); }
+
+    /** Re-runs the prepare function on existing state (call from prepareToPlay only). */
+    void prepareIfAllocated()
+    {
+        if (algorithm != nullptr)
+            prepare (*algorithm);
+    }
+
+protected:
+    void createState() override
+    {
+        algorithm = std::make_unique<AlgorithmType>();
+        prepare (*algorithm);
+    }
+
+    void destroyState() override
+    {
+        algorithm.reset();
+    }
+
+    size_t getStateBytes() const override
+    {
+        return sizeof (AlgorithmType) + heapBytes;
+    }
+
+private:
+    std::function<void (AlgorithmType&)> prepare;
+    size_t heapBytes = 0;
+    std::unique_ptr<AlgorithmType> algorithm;
+};
+
+//==============================================================================
+/**
+    Tracks which algorithm of a section is selected, owns the handover of
+    slot state between the audio and message threads and crossfades between
+    the outgoing and incoming algorithm on a change.
+    Stateless algorithms (e.g. Clean) simply have no slot.
+
+    The section supplies two callables with signatures
+        SampleType processAlgorithm (int algorithm, SampleType input)
+        void resetAlgorithm (int algorithm)
+    that dispatch to the algorithm objects (SampleType is float, or double for
+    the 64-bit path, so the process callable is usually a generic lambda).
+*/
+template <int NumAlgorithms>
+class AlgorithmStateSet
+{
+public:
+    static constexpr int noAlgorithm = -1;
+
+    using StateMask = std::array<bool, NumAlgorithms>;
+
+    AlgorithmStateSet()
+    {
+        for (auto& slot : slots)
+            slot = nullptr;
+    }
+
+    /** Registers the slot for an algorithm (nullptr = stateless algorithm). */
+    void setSlot (int algorithm, AlgorithmStateSlotBase* slot)
+    {
+        jassert (algorithm >= 0 && algorithm < NumAlgorithms);
+        slots[algorithm] = slot;
+    }
+
+    void setSampleRate (double sampleRate)
+    {
+        cancelTransition();
+        crossfader.setSampleRate (sampleRate);
+    }
+
+    /**
+        Adds the per-block denormal offset (DenormalPolicy.h) to the input of
+        the algorithms that have state - for sections whose algorithms are
+        Airwindows ports. Stateless algorithms (Clean) never see it.
+    */
+    void setUsesDenormalOffset (bool shouldUseOffset)
+    {
+        usesDenormalOffset = shouldUseOffset;
+    }
+
+    //==============================================================================
+    // Audio thread
+
+    /**
+        Requests an algorithm. If its state is allocated, the incoming algorithm is
+        reset, pre-warmed from the input history and crossfaded in. Otherwise the
+        current algorithm keeps running and the message thread is flagged to
+        allocate the requested one.
+        A request made during a crossfade is deferred until the fade has finished
+        (sections re-apply their selection every block, which also flips the
+        denormal offset).
+    */
+    template <typename ProcessFunction, typename ResetFunction>
+    void select (int algorithm, ProcessFunction&& processAlgorithm, ResetFunction&& resetAlgorithm)
+    {
+        switchTo (algorithm, processAlgorithm, resetAlgorithm);
+
+        const float offset = usesDenormalOffset ? denormalOffset.next() : 0.0f;
+        inputOffset = (active != noAlgorithm && slots[active] != nullptr) ? offset : 0.0f;
+    }
+
+    /**
+        Processes one sample through the active algorithm, and through the
+        outgoing one while a crossfade is running.
+    */
+    template <typename SampleType, typename ProcessFunction>
+    SampleType process (SampleType input, ProcessFunction&& processAlgorithm)
+    {
+        crossfader.pushInput (static_cast<float> (input));
+        input += static_cast<SampleType> (inputOffset);
+
+        const SampleType incoming = processAlgorithm (active, input);
+
+        if (! crossfader.isFading())
+            return incoming;
+
+        const SampleType output = crossfader.mix (processAlgorithm (outgoing, input), incoming);
+
+        if (! crossfader.isFading())
+            finishTransition();
+
+        return output;
+    }
+
+    /** Resets the algorithms owned by the audio thread and cancels any running fade. */
+    template <typename ResetFunction>
+    void reset (ResetFunction&& resetAlgorithm)
+    {
+        cancelTransition();
+        resetAlgorithm (active);
+        crossfader.reset();
+        denormalOffset.reset();
+    }
+
+    /**
+        Records section input that was processed outside process() (e.g. by a
+        stereo-linked path), so pre-warming still sees the recent signal.
+    */
+    template <typename SampleType>
+    void recordInput (const SampleType* input, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            crossfader.pushInput (static_cast<float> (input[i]));
+    }
+
+    /** The algorithm the audio thread is running (noAlgorithm before the first allocation). */
+    int getActive() const { return active; }
+
+    /** True while the outgoing algorithm is still being crossfaded out. */
+    bool isTransitioning() const { return crossfader.isFading(); }
+
+    /** Returns true (once) if allocations need updating on the message thread. */
+    bool checkAndClearUpdateFlag() { return needsUpdate.exchange (false); }
+
+    //==============================================================================
+    // Message thread (or prepareToPlay)
+
+    /**
+        Allocates the state for the given algorithm and frees all others that
+        the audio thread isn't holding.
+    */
+    void updateAllocations (int algorithmToKeep)
+    {
+        StateMask statesToKeep {};
+
+        if (algorithmToKeep >= 0 && algorithmToKeep < NumAlgorithms)
+            statesToKeep[static_cast<size_t> (algorithmToKeep)] = true;
+
+        updateAllocations (statesToKeep);
+    }
+
+    /**
+        Allocates the state of every algorithm flagged in statesToKeep and
+        frees all others that the audio thread isn't holding (offline renders
+        keep every selectable state, so a switch never waits).
+    */
+    void updateAllocations (const StateMask& statesToKeep)
+    {
+        for (int i = 0; i < NumAlgorithms; ++i)
+        {
+            if (slots[i] == nullptr)
+                continue;
+
+            if (statesToKeep[static_cast<size_t> (i)])
+                slots[i]->allocate();
+            else
+                slots[i]->free();
+        }
+    }
+
+    /** Heap bytes currently held by all slots and the crossfader history. */
+    size_t getAllocatedBytes() const
+    {
+        size_t total = crossfader.getHistoryBytes();
+        for (auto* slot : slots)
+            if (slot != nullptr)
+                total += slot->getAllocatedBytes();
+        return total;
+    }
+
+private:
+    /** select() without the offset update. */
+    template <typename ProcessFunction, typename ResetFunction>
+    void switchTo (int algorithm, ProcessFunction& processAlgorithm, ResetFunction& resetAlgorithm)
+    {
+        jassert (algorithm >= 0 && algorithm < NumAlgorithms);
+
+        if (algorithm == active || crossfader.isFading())
+            return;
+
+        if (auto* next = slots[algorithm])
+        {
+            if (! next->acquire())
+            {
+                needsUpdate.store (true);
+                return;
+            }
+        }
+
+        // The incoming state may be stale from earlier use - start clean and
+        // let it settle on the recent input before it becomes audible
+        resetAlgorithm (algorithm);
+        crossfader.prewarm ([&] (float x) { processAlgorithm (algorithm, x); });
+
+        outgoing = active;
+        active = algorithm;
+
+        if (outgoing == noAlgorithm)
+            return;  // Nothing was running yet (first selection), no fade needed
+
+        crossfader.startFade();
+    }
+
+    /** Hands the outgoing algorithm's state back so it can be freed. */
+    void finishTransition()
+    {
+        if (outgoing != noAlgorithm && slots[outgoing] != nullptr)
+        {
+            slots[outgoing]->release();
+            needsUpdate.store (true);  // Previous state can now be freed
+        }
+
+        outgoing = noAlgorithm;
+    }
+
+    void cancelTransition()
+    {
+        if (crossfader.isFading())
+        {
+            crossfader.stopFade();
+            finishTransition();
+        }
+    }
+
+    AlgorithmStateSlotBase* slots[NumAlgorithms];
+    int active = noAlgorithm;    // Audio thread only
+    int outgoing = noAlgorithm;  // Audio thread only, valid while fading
+    AlgorithmCrossfader crossfader;
+    Denormals::BlockOffset denormalOffset;
+    float inputOffset = 0.0f;    // Audio thread: this block's offset for the active algorithm
+    bool usesDenormalOffset = false;
+    std::atomic<bool> needsUpdate { false };
+
+    JUCE_DECLARE_NON_COPYABLE (AlgorithmStateSet)
+};
@@ -3,7 +3,7 @@
 
     BypassableSection.h
     Base class for all AnalogChannel processing sections
-    Provides smooth bypass with 10ms crossfade
+    Provides block processing with a smooth 10ms bypass crossfade
 
     Copyright (c) 2024 KuramaSound
     Licensed under GPL v3 - see LICENSE file for details
@@ -14,15 +14,33 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../BlockKernels.h"
+#include <type_traits>
 
 //==============================================================================
 /**
     Base class for all processing sections in AnalogChannel.
     Provides smooth bypass functionality with 10ms crossfade to avoid clicks/pops.
 
-    Each section should inherit from this and implement processInternal().
+    Each section should inherit from this and implement processInternal()
+    (and optionally processInternalBlock() / updateDetectorsWhileBypassed()).
+
+    Blocks can be float or double (hosts with 64-bit processing). The double
+    path runs processInternalDouble(), which sections whose algorithms compute
+    in double override; the default converts to float around processInternal().
+
+    Sections are cache-line aligned: the processor keeps them in [2] arrays,
+    and L and R may run on different threads (multicore / offline renders),
+    so neighbouring instances must not share a line.
+
+    Each instance is one lane (L or R). Its members are split into a
+    HotState (per-sample state and whatever the per-sample path reads),
+    declared first so it follows the base's own state (one line), and a Config
+    (settings, only touched by the setters). Algorithm slots and other
+    rarely touched members come after both; getHotStateBytes() and
+    getConfigBytes() feed the benchmark target's layout report.
 */
-class BypassableSection
+class alignas (64) BypassableSection
 {
 public:
     BypassableSection() = default;
@@ -46,6 +64,15 @@ public:
         return targetBypass;
     }
 
+    /**
+        Returns true if the section is processing and not in a bypass crossfade
+        (the precondition for the stereo-linked paths).
+    */
+    bool isFullyActive() const
+    {
+        return ! targetBypass && wetPosition == fadeSamples;
+    }
+
     /**
         Initializes the section with the current sample rate.
         Call this in prepareToPlay().
@@ -55,12 +82,15 @@ public:
     {
         currentSampleRate = sampleRate;
         // 10ms crossfade time
-        fadeCoeff = 1.0f / (0.01f * static_cast<float>(sampleRate));
+        fadeSamples = juce::jmax (1, static_cast<int> (0.01 * sampleRate));
+
+        // A fade doesn't survive a re-prepare: settle on the target state
+        wetPosition = targetBypass ? 0 : fadeSamples;
     }
 
     /**
         Resets the section's internal state.
-        Call this when audio processing starts/stops.
+        Call this when audio processing starts/stops (never from processBlock).
     */
     virtual void reset()
     {
@@ -68,58 +98,71 @@ public:
     }
 
     /**
-        Processes a single sample with smooth bypass crossfading.
-        @param input the input sample
-        @return the processed output sample
+        Hands the section scratch space (processor's ScratchArena, prepareToPlay)
+        for blocks of up to maxSamples in the sample type the chain runs in:
+        getNumScratchBlocks() * maxSamples values. The bypass crossfade keeps
+        its dry copy and ramp in the first two blocks, the section's own block
+        paths use the rest; without scratch both work in 64-sample stack chunks.
     */
-    float process (float input)
+    void setScratch (float* scratch, int maxSamples)
     {
-        // CRITICAL: If bypassed, return input immediately (no processing)
-        if (targetBypass)
-        {
-            // Reset state immediately when bypass is activated
-            if (bypassMix == 0.0f)
-            {
-                reset();  // Reset on first bypass call
-            }
-
-            // Smooth fade to bypass to avoid clicks
-            if (bypassMix < 0.99f)
-            {
-                bypassMix += (1.0f - bypassMix) * fadeCoeff;
-                if (bypassMix > 0.99f)
-                {
-                    bypassMix = 1.0f;
-                }
-
-                // During fade: NO PROCESSING, just crossfade dry signal
-                // This prevents processing from affecting the signal during bypass
-                return input;
-            }
-            else
-            {
-                // Fully bypassed: skip processing entirely (no processInternal call)
-                return input;
-            }
-        }
-        else
-        {
-            // Fade back to processing
-            if (bypassMix > 0.01f)
-            {
-                bypassMix += (0.0f - bypassMix) * fadeCoeff;
-                if (bypassMix < 0.01f) bypassMix = 0.0f;
-
-                // During fade: mix wet and dry
-                float wet = processInternal (input);
-                return wet * (1.0f - bypassMix) + input * bypassMix;
-            }
-            else
-            {
-                // Fully active: process normally
-                return processInternal (input);
-            }
-        }
+        floatScratch = scratch;
+        doubleScratch = nullptr;
+        scratchSamples = scratch != nullptr ? maxSamples : 0;
+    }
+
+    void setScratch (double* scratch, int maxSamples)
+    {
+        floatScratch = nullptr;
+        doubleScratch = scratch;
+        scratchSamples = scratch != nullptr ? maxSamples : 0;
+    }
+
+    /** Scratch blocks (of maxSamples each) setScratch() must provide. */
+    int getNumScratchBlocks() const
+    {
+        return numCrossfadeScratchBlocks + getNumSectionScratchBlocks();
+    }
+
+    /**
+        Keeps the section's envelope detectors running (at control rate, once per
+        block) while bypassed, so re-engaging doesn't pump from a stale envelope.
+        Only affects sections that implement updateDetectorsWhileBypassed().
+    */
+    void setDetectorsRunWhileBypassed (bool shouldRun)
+    {
+        runDetectorsWhileBypassed = shouldRun;
+    }
+
+    //==============================================================================
+    /**
+        Processes a block in place with smooth bypass crossfading.
+
+        - Active: processInternalBlock() on the whole block.
+        - Bypassed: the block is left untouched (optionally the detectors are
+          updated once per block).
+        - Bypass change: an equal-gain crossfade over 10ms, applied with
+          vectorised ramps. The fade position is kept between calls, so the
+          ramp spans as many blocks as it needs (small host buffers, chunked
+          processing) and a change back mid-fade reverses from where it is.
+          Only the samples inside the ramp pay for wet and dry at once; a
+          fade-out stops processing at the end of the ramp.
+
+        State is never reset on the audio thread: a section fades back in from
+        where it stopped (see reset()).
+
+        @param data the samples to process (in place)
+        @param numSamples number of samples in the block
+    */
+    void processBlock (float* data, int numSamples)
+    {
+        processBlockWithCrossfade (data, numSamples);
+    }
+
+    /** Double-precision version of processBlock(). */
+    void processBlock (double* data, int numSamples)
+    {
+        processBlockWithCrossfade (data, numSamples);
     }
 
 protected:
@@ -131,12 +174,225 @@ protected:
     */
     virtual float processInternal (float input) = 0;
 
-    double currentSampleRate = 44100.0;
+    /**
+        Processes a block in place. The default runs processInternal() per sample;
+        sections override this where a block implementation is cheaper.
+    */
+    virtual void processInternalBlock (float* data, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            data[i] = processInternal (data[i]);
+    }
+
+    /**
+        Double-precision version of processInternal(). Sections whose algorithms
+        compute in double override this to skip the float round trip.
+    */
+    virtual double processInternalDouble (double input)
+    {
+        return static_cast<double> (processInternal (static_cast<float> (input)));
+    }
+
+    /** Double-precision version of processInternalBlock(). */
+    virtual void processInternalBlockDouble (double* data, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            data[i] = processInternalDouble (data[i]);
+    }
+
+    //==============================================================================
+    /** Scratch blocks the section's own block paths use (dry copies, detector gains). */
+    virtual int getNumSectionScratchBlocks() const
+    {
+        return 0;
+    }
+
+    /**
+        The section's scratch block (0 to getNumSectionScratchBlocks() - 1), or
+        nullptr without scratch in this sample type. Holds getScratchSamples().
+    */
+    template <typename SampleType>
+    SampleType* getSectionScratch (int block) const
+    {
+        jassert (block >= 0 && block < getNumSectionScratchBlocks());
+        auto* scratch = getScratch<SampleType>();
+        return scratch != nullptr ? scratch + (numCrossfadeScratchBlocks + block) * scratchSamples : nullptr;
+    }
+
+    int getScratchSamples() const { return scratchSamples; }
+
+    /**
+        Dry/wet mix for sections with a mix control. Each chunk is copied to
+        section scratch block 0 (the stack without scratch), processWet (chunk,
+        num) runs over it in place, then chunk = wet * mix + dry * (1 - mix).
+    */
+    template <typename SampleType, typename WetFunction>
+    void processWithDryMix (SampleType* data, int numSamples, float mix, WetFunction&& processWet)
+    {
+        SampleType stackDry[chunkSize];
+        SampleType* dry = getSectionScratch<SampleType> (0);
+        const int maxChunk = dry != nullptr ? scratchSamples : chunkSize;
+
+        if (dry == nullptr)
+            dry = stackDry;
+
+        for (int offset = 0; offset < numSamples; offset += maxChunk)
+        {
+            const int num = juce::jmin (maxChunk, numSamples - offset);
+            SampleType* wet = data + offset;
+
+            juce::FloatVectorOperations::copy (dry, wet, num);
+            processWet (wet, num);
+
+            juce::FloatVectorOperations::multiply (wet, static_cast<SampleType> (mix), num);
+            juce::FloatVectorOperations::addWithMultiply (wet, dry, static_cast<SampleType> (1.0f - mix), num);
+        }
+    }
+
+    /**
+        Called once per block while fully bypassed (if enabled with
+        setDetectorsRunWhileBypassed()). Dynamics sections advance their envelope
+        detectors here at control rate; the input must not be modified.
+    */
+    virtual void updateDetectorsWhileBypassed (const float* input, int numSamples)
+    {
+        juce::ignoreUnused (input, numSamples);
+    }
+
+    //==============================================================================
+    // Block level helpers for control-rate detectors
+    static float getBlockMeanAbsolute (const float* data, int numSamples)
+    {
+        return numSamples > 0 ? BlockKernels::sumOfAbsolutes (data, numSamples) / static_cast<float> (numSamples) : 0.0f;
+    }
+
+    static float getBlockPeak (const float* data, int numSamples)
+    {
+        return BlockKernels::findPeak (data, numSamples);
+    }
 
 private:
-    bool targetBypass = false;      // Target bypass state
-    float bypassMix = 0.0f;         // 0.0 = processing, 1.0 = bypassed
-    float fadeCoeff = 0.0f;         // Crossfade coefficient
+    //==============================================================================
+    template <typename SampleType>
+    void processBlockWithCrossfade (SampleType* data, int numSamples)
+    {
+        const int targetPosition = targetBypass ? 0 : fadeSamples;
+
+        if (wetPosition == targetPosition)
+        {
+            if (! targetBypass)
+                runInternalBlock (data, numSamples);
+            else if (runDetectorsWhileBypassed)
+                advanceBypassedDetectors (data, numSamples);
+
+            return;
+        }
 
+        // Crossfade (continued from the previous block if it didn't finish there)
+        const int direction = targetBypass ? -1 : 1;
+        const int rampLength = juce::jmin (numSamples, std::abs (targetPosition - wetPosition));
+        const SampleType step = SampleType (1) / static_cast<SampleType> (fadeSamples);
+
+        SampleType stackDry[chunkSize];
+        SampleType stackRamp[chunkSize];
+        SampleType* dry = getScratch<SampleType>();
+        SampleType* ramp = dry != nullptr ? dry + scratchSamples : stackRamp;
+        const int maxChunk = dry != nullptr ? scratchSamples : chunkSize;
+
+        if (dry == nullptr)
+            dry = stackDry;
+
+        for (int offset = 0; offset < rampLength; offset += maxChunk)
+        {
+            const int num = juce::jmin (maxChunk, rampLength - offset);
+            SampleType* wet = data + offset;
+
+            juce::FloatVectorOperations::copy (dry, wet, num);
+            runInternalBlock (wet, num);
+
+            // Linear wet gain along the 10ms ramp (equal-gain: wet and dry are correlated)
+            fillRamp (ramp, static_cast<SampleType> (wetPosition + direction * (offset + 1)) * step,
+                      static_cast<SampleType> (direction) * step, num);
+
+            // dry + (wet - dry) * ramp
+            juce::FloatVectorOperations::subtract (wet, wet, dry, num);
+            juce::FloatVectorOperations::multiply (wet, ramp, num);
+            juce::FloatVectorOperations::add (wet, dry, num);
+        }
+
+        wetPosition += direction * rampLength;
+
+        // Rest of the block once the ramp ended: fully dry (fade-out, left untouched) or fully wet
+        if (wetPosition == fadeSamples && rampLength < numSamples)
+            runInternalBlock (data + rampLength, numSamples - rampLength);
+    }
+
+    /**
+        Fills ramp[i] = start + i * increment with vector adds: each pass copies
+        the filled part, offset by its length (log2 (num) passes).
+    */
+    template <typename SampleType>
+    static void fillRamp (SampleType* ramp, SampleType start, SampleType increment, int num)
+    {
+        if (num <= 0)
+            return;
+
+        ramp[0] = start;
+
+        for (int filled = 1; filled < num; filled *= 2)
+            juce::FloatVectorOperations::add (ramp + filled, ramp, static_cast<SampleType> (filled) * increment,
+                                              juce::jmin (filled, num - filled));
+    }
+
+    template <typename SampleType>
+    SampleType* getScratch() const
+    {
+        if constexpr (std::is_same_v<SampleType, double>)
+            return doubleScratch;
+        else
+            return floatScratch;
+    }
+
+    void runInternalBlock (float* data, int numSamples)  { processInternalBlock (data, numSamples); }
+    void runInternalBlock (double* data, int numSamples) { processInternalBlockDouble (data, numSamples); }
+
+    void advanceBypassedDetectors (const float* data, int numSamples)
+    {
+        updateDetectorsWhileBypassed (data, numSamples);
+    }
+
+    void advanceBypassedDetectors (const double* data, int numSamples)
+    {
+        // The detectors work on float blocks: convert in chunks (each chunk
+        // advances the detectors by its own length, same closed form)
+        float converted[detectorChunkSize];
+
+        for (int offset = 0; offset < numSamples; offset += detectorChunkSize)
+        {
+            const int num = juce::jmin (detectorChunkSize, numSamples - offset);
+            for (int i = 0; i < num; ++i)
+                converted[i] = static_cast<float> (data[offset + i]);
+
+            updateDetectorsWhileBypassed (converted, num);
+        }
+    }
+
+    static constexpr int chunkSize = 64;            // Stack buffer for the dry copy during crossfades (no scratch)
+    static constexpr int numCrossfadeScratchBlocks = 2;  // Dry copy and ramp
+    static constexpr int detectorChunkSize = 512;   // Stack buffer for double blocks while bypassed
+
+    bool targetBypass = false;          // Target bypass state
+    bool runDetectorsWhileBypassed = false;
+    int fadeSamples = 441;              // Crossfade length (10ms)
+    int wetPosition = 441;              // Audio thread: 0 = bypassed, fadeSamples = active, in between = fading
+
+    float* floatScratch = nullptr;      // Owned by the processor's ScratchArena
+    double* doubleScratch = nullptr;
+    int scratchSamples = 0;
+
+protected:
+    double currentSampleRate = 44100.0;  // Only read when preparing / updating coefficients
+
+private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BypassableSection)
 };
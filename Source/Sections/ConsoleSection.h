@@ -22,6 +22,8 @@
 #pragma once
 
 #include "BypassableSection.h"
+#include "AlgorithmStateSlot.h"
+#include "../ParameterSnapshot.h"
 #include "../Algorithms/PurestConsole3Channel.h"
 #include "../Algorithms/Channel8Console.h"
 
@@ -39,33 +41,82 @@ public:
         Pure = 1,   // PurestConsole3Channel (faithful AirWindows port)
         Oxford = 2, // SSL (Channel8)
         Essex = 3,  // Neve (Channel8)
-        USA = 4     // API (Channel8)
+        USA = 4,    // API (Channel8)
+        NumAlgorithms
     };
 
     ConsoleSection()
     {
-        // Configure Channel8 console types
-        consoleSSL.setConsoleType (Channel8Console::SSL);
-        consoleNeve.setConsoleType (Channel8Console::Neve);
-        consoleAPI.setConsoleType (Channel8Console::API);
+        // Only the selected console's state is allocated (Clean is stateless)
+        algorithmStates.setSlot (Pure, &pureConsole);
+        algorithmStates.setSlot (Oxford, &consoleSSL);
+        algorithmStates.setSlot (Essex, &consoleNeve);
+        algorithmStates.setSlot (USA, &consoleAPI);
+
+        algorithmStates.setSlot (OxfordFloat, &consoleSSLFloat);
+        algorithmStates.setSlot (EssexFloat, &consoleNeveFloat);
+        algorithmStates.setSlot (USAFloat, &consoleAPIFloat);
+
+        // Airwindows ports: the per-block denormal offset (DenormalPolicy.h)
+        algorithmStates.setUsesDenormalOffset (true);
     }
 
     //==============================================================================
     void setSampleRate (double sampleRate) override
     {
         BypassableSection::setSampleRate (sampleRate);
-        pureConsole.setSampleRate (sampleRate);
-        consoleSSL.setSampleRate (sampleRate);
-        consoleNeve.setSampleRate (sampleRate);
-        consoleAPI.setSampleRate (sampleRate);
+        pureConsole.prepareIfAllocated();
+        consoleSSL.prepareIfAllocated();
+        consoleNeve.prepareIfAllocated();
+        consoleAPI.prepareIfAllocated();
+        consoleSSLFloat.prepareIfAllocated();
+        consoleNeveFloat.prepareIfAllocated();
+        consoleAPIFloat.prepareIfAllocated();
+        algorithmStates.setSampleRate (sampleRate);
     }
 
     void reset() override
     {
-        pureConsole.reset();
-        consoleSSL.reset();
-        consoleNeve.reset();
-        consoleAPI.reset();
+        // Only the active console is owned by the audio thread
+        algorithmStates.reset ([this] (int algo) { resetAlgorithm (algo); });
+    }
+
+    //==============================================================================
+    /**
+        Allocates the state for the given console and frees unused ones.
+        Call from the message thread (or prepareToPlay), never from the audio thread.
+    */
+    void updateAlgorithmStates (Algorithm algo, bool useEcoPrecision = false)
+    {
+        algorithmStates.updateAllocations (getStateIndex (algo, useEcoPrecision));
+    }
+
+    /**
+        Allocates the state of every algorithm in the given precision (offline
+        renders, where a switch must not wait for the message thread). Same
+        threading as updateAlgorithmStates(); the next updateAlgorithmStates()
+        frees them.
+    */
+    void allocateAllAlgorithmStates (bool useEcoPrecision)
+    {
+        AlgorithmStateSet<NumStates>::StateMask statesToKeep {};
+
+        for (int algo = 0; algo < NumAlgorithms; ++algo)
+            statesToKeep[static_cast<size_t> (getStateIndex (static_cast<Algorithm> (algo), useEcoPrecision))] = true;
+
+        algorithmStates.updateAllocations (statesToKeep);
+    }
+
+    /** Returns true (once) if updateAlgorithmStates() needs to run on the message thread. */
+    bool needsAlgorithmStateUpdate()
+    {
+        return algorithmStates.checkAndClearUpdateFlag();
+    }
+
+    /** Per-instance memory: section object plus allocated console state. */
+    size_t getStateBytes() const
+    {
+        return sizeof (*this) + algorithmStates.getAllocatedBytes();
     }
 
     //==============================================================================
@@ -75,7 +126,19 @@ public:
     */
     void setAlgorithm (Algorithm algo)
     {
-        currentAlgorithm = algo;
+        config.algorithm = algo;
+        algorithmStates.select (getStateIndex (algo, config.ecoPrecision),
+                                [this] (int a, float x) { return processAlgorithm (a, x); },
+                                [this] (int a) { resetAlgorithm (a); });
+    }
+
+    /**
+        Runs the Channel8 consoles in float (Channel8ConsoleFloat). Pure stays
+        in double. Applied by the next setAlgorithm() call.
+    */
+    void setEcoPrecision (bool shouldUseFloat)
+    {
+        config.ecoPrecision = shouldUseFloat;
     }
 
     /**
@@ -85,41 +148,101 @@ public:
     */
     void setDrive (float dB)
     {
-        driveDB = dB;
-        driveGain = std::pow (10.0f, dB / 20.0f);
+        config.driveDB = dB;
+        hot.driveGain = std::pow (10.0f, dB / 20.0f);
+    }
+
+    /**
+        Applies the Console fields of the block's parameter snapshot. The
+        algorithm is re-selected every block (deferred selections); the drive,
+        which carries the channel variation offset, only when it changed.
+    */
+    void applyParameters (const ParameterSnapshot& params, const ChannelVariationPreset& variation)
+    {
+        using P = ParameterSnapshot;
+
+        setEcoPrecision (params.getBool (P::EcoPrecision));
+        setAlgorithm (static_cast<Algorithm> (params.getChoice (P::ConsoleAlgo)));
+
+        if (params.hasChanged (P::mask (P::ConsoleDrive) | P::channelVariationFields))
+            setDrive (params[P::ConsoleDrive] + variation.consoleDrive);
+        if (params.hasChanged (P::mask (P::ConsoleBypass)))
+            setBypass (params.getBool (P::ConsoleBypass));
     }
 
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
+
 protected:
     //==============================================================================
     float processInternal (float input) override
     {
-        if (currentAlgorithm == Clean)
+        // Runs the active console (crossfaded from the outgoing one after a change).
+        // The active console may briefly lag config.algorithm while the newly
+        // selected console's state is being allocated.
+        return algorithmStates.process (input, [this] (int algo, auto x) { return processAlgorithm (algo, x); });
+    }
+
+    double processInternalDouble (double input) override
+    {
+        return algorithmStates.process (input, [this] (int algo, auto x) { return processAlgorithm (algo, x); });
+    }
+
+private:
+    // Channel8 float (eco precision) variants, after the regular algorithms
+    enum FloatVariant
+    {
+        OxfordFloat = NumAlgorithms + Oxford,
+        EssexFloat = NumAlgorithms + Essex,
+        USAFloat = NumAlgorithms + USA,
+        NumStates = NumAlgorithms * 2
+    };
+
+    //==============================================================================
+    template <typename SampleType>
+    SampleType processAlgorithm (int algo, SampleType input)
+    {
+        if (algo == Clean || algo == AlgorithmStateSet<NumStates>::noAlgorithm)
         {
             // Clean: bypass
             return input;
         }
 
         // Apply drive (increase level before console)
-        float driven = input * driveGain;
+        SampleType driven = input * hot.driveGain;
 
         // Process through console algorithm
-        float processed;
-        switch (currentAlgorithm)
+        SampleType processed;
+        switch (algo)
         {
             case Pure:
-                processed = pureConsole.process (driven);
+                processed = pureConsole.get()->process (driven);
                 break;
 
             case Oxford:
-                processed = consoleSSL.process (driven);
+                processed = consoleSSL.get()->process (driven);
                 break;
 
             case Essex:
-                processed = consoleNeve.process (driven);
+                processed = consoleNeve.get()->process (driven);
                 break;
 
             case USA:
-                processed = consoleAPI.process (driven);
+                processed = consoleAPI.get()->process (driven);
+                break;
+
+            case OxfordFloat:
+                processed = consoleSSLFloat.get()->process (driven);
+                break;
+
+            case EssexFloat:
+                processed = consoleNeveFloat.get()->process (driven);
+                break;
+
+            case USAFloat:
+                processed = consoleAPIFloat.get()->process (driven);
                 break;
 
             default: // Clean
@@ -128,19 +251,67 @@ protected:
         }
 
         // Compensate drive (decrease level after console)
-        return processed / driveGain;
+        return processed / hot.driveGain;
+    }
+
+    void resetAlgorithm (int algo)
+    {
+        switch (algo)
+        {
+            case Pure: pureConsole.get()->reset(); break;
+            case Oxford: consoleSSL.get()->reset(); break;
+            case Essex: consoleNeve.get()->reset(); break;
+            case USA: consoleAPI.get()->reset(); break;
+            case OxfordFloat: consoleSSLFloat.get()->reset(); break;
+            case EssexFloat: consoleNeveFloat.get()->reset(); break;
+            case USAFloat: consoleAPIFloat.get()->reset(); break;
+            default: break;
+        }
+    }
+
+    /** State set index: Channel8 float variants sit NumAlgorithms further up. */
+    static int getStateIndex (Algorithm algo, bool useEcoPrecision)
+    {
+        if (useEcoPrecision && (algo == Oxford || algo == Essex || algo == USA))
+            return algo + NumAlgorithms;
+
+        return algo;
+    }
+
+    template <typename Channel8Type>
+    void prepareChannel8 (Channel8Type& console, typename Channel8Type::ConsoleType type)
+    {
+        console.setConsoleType (type);
+        console.setSampleRate (currentSampleRate);
     }
 
-private:
     //==============================================================================
-    PurestConsole3Channel pureConsole;
-    Channel8Console consoleSSL;   // Channel8 configured as SSL
-    Channel8Console consoleNeve;  // Channel8 configured as Neve
-    Channel8Console consoleAPI;   // Channel8 configured as API
-
-    Algorithm currentAlgorithm = Clean;  // Default: Clean (bypass)
-    float driveDB = 0.0f;
-    float driveGain = 1.0f;
+    struct HotState
+    {
+        float driveGain = 1.0f;
+    };
+
+    struct Config
+    {
+        Algorithm algorithm = Clean;  // Default: Clean (bypass)
+        float driveDB = 0.0f;
+        bool ecoPrecision = false;
+    };
+
+    HotState hot;
+    AlgorithmStateSet<NumStates> algorithmStates;  // Active console and crossfade
+    Config config;
+
+    // Consoles (state allocated on demand, see AlgorithmStateSlot.h)
+    // NOTE: Console type must be set before the sample rate (it scales the HPF coefficient)
+    AlgorithmStateSlot<PurestConsole3Channel> pureConsole { [this] (PurestConsole3Channel& c) { c.setSampleRate (currentSampleRate); } };
+    AlgorithmStateSlot<Channel8Console> consoleSSL { [this] (Channel8Console& c) { prepareChannel8 (c, Channel8Console::SSL); } };
+    AlgorithmStateSlot<Channel8Console> consoleNeve { [this] (Channel8Console& c) { prepareChannel8 (c, Channel8Console::Neve); } };
+    AlgorithmStateSlot<Channel8Console> consoleAPI { [this] (Channel8Console& c) { prepareChannel8 (c, Channel8Console::API); } };
+
+    AlgorithmStateSlot<Channel8ConsoleFloat> consoleSSLFloat { [this] (Channel8ConsoleFloat& c) { prepareChannel8 (c, Channel8ConsoleFloat::SSL); } };
+    AlgorithmStateSlot<Channel8ConsoleFloat> consoleNeveFloat { [this] (Channel8ConsoleFloat& c) { prepareChannel8 (c, Channel8ConsoleFloat::Neve); } };
+    AlgorithmStateSlot<Channel8ConsoleFloat> consoleAPIFloat { [this] (Channel8ConsoleFloat& c) { prepareChannel8 (c, Channel8ConsoleFloat::API); } };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ConsoleSection)
 };
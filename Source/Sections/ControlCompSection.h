@@ -11,6 +11,8 @@
 #pragma once
 
 #include "BypassableSection.h"
+#include "StereoLink.h"
+#include "../ParameterSnapshot.h"
 #include "../Algorithms/DigitalVersatileCompressor.h"
 
 //==============================================================================
@@ -33,13 +35,13 @@ public:
     void setSampleRate (double sampleRate) override
     {
         BypassableSection::setSampleRate (sampleRate);
-        compressor.setSampleRate (sampleRate);
+        hot.compressor.setSampleRate (sampleRate);
         updateCompressorParameters();
     }
 
     void reset() override
     {
-        compressor.reset();
+        hot.compressor.reset();
     }
 
     //==============================================================================
@@ -49,7 +51,7 @@ public:
     */
     void setThreshold (float dB)
     {
-        thresholdDB = juce::jlimit (-30.0f, -0.1f, dB);
+        config.thresholdDB = juce::jlimit (-30.0f, -0.1f, dB);
         updateCompressorParameters();
     }
 
@@ -59,24 +61,95 @@ public:
     */
     void setARMode (ARMode mode)
     {
-        arMode = mode;
+        config.arMode = mode;
         updateCompressorParameters();
     }
 
+    /**
+        Applies the Control-Comp fields of the block's parameter snapshot
+        (threshold and A/R together cost one compressor update).
+    */
+    void applyParameters (const ParameterSnapshot& params)
+    {
+        using P = ParameterSnapshot;
+
+        if (params.hasChanged (P::mask (P::CtrlCompThresh, P::CtrlCompAR)))
+        {
+            // Parameter order: { "Normal", "Fast" }
+            config.thresholdDB = juce::jlimit (-30.0f, -0.1f, params[P::CtrlCompThresh]);
+            config.arMode = params.getBool (P::CtrlCompAR) ? Fast : Normal;
+            updateCompressorParameters();
+        }
+
+        if (params.hasChanged (P::mask (P::CtrlCompBypass)))
+            setBypass (params.getBool (P::CtrlCompBypass));
+
+        // Keep the envelope moving while bypassed so re-engaging doesn't pump
+        if (params.hasChanged (P::mask (P::DetectorsWhileBypassed)))
+            setDetectorsRunWhileBypassed (params.getBool (P::DetectorsWhileBypassed));
+    }
+
     /**
         Get current gain reduction for metering.
         @return gain reduction in dB (negative value)
     */
     float getGainReductionDB() const
     {
-        return compressor.getGainReductionDB();
+        return hot.compressor.getGainReductionDB();
+    }
+
+    //==============================================================================
+    /** True if both sections can run the stereo-linked path this block. */
+    static bool canProcessLinked (const ControlCompSection& left, const ControlCompSection& right)
+    {
+        return left.isFullyActive() && right.isFullyActive();
+    }
+
+    /**
+        Stereo-linked processing: the left section's detector runs on the linked
+        level and its gain trajectory is applied to both channels. The right
+        detector is kept in sync so unlinking is seamless (and meters match).
+    */
+    template <typename SampleType>
+    static void processStereoLinked (ControlCompSection& left, ControlCompSection& right,
+                                     SampleType* leftData, SampleType* rightData, int numSamples,
+                                     StereoLink::Mode mode)
+    {
+        SampleType gains[StereoLink::chunkSize];
+
+        for (int offset = 0; offset < numSamples; offset += StereoLink::chunkSize)
+        {
+            const int num = juce::jmin (StereoLink::chunkSize, numSamples - offset);
+            SampleType* l = leftData + offset;
+            SampleType* r = rightData + offset;
+
+            StereoLink::computeLevels (gains, l, r, num, mode);
+
+            for (int i = 0; i < num; ++i)
+                gains[i] = left.hot.compressor.updateGain (static_cast<float> (gains[i]));
+
+            juce::FloatVectorOperations::multiply (l, gains, num);
+            juce::FloatVectorOperations::multiply (r, gains, num);
+        }
+
+        right.hot.compressor.copyStateFrom (left.hot.compressor);
     }
 
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
+
 protected:
     //==============================================================================
     float processInternal (float input) override
     {
-        return compressor.process (input);
+        return hot.compressor.process (input);
+    }
+
+    void updateDetectorsWhileBypassed (const float* input, int numSamples) override
+    {
+        hot.compressor.advanceDetector (getBlockMeanAbsolute (input, numSamples), numSamples);
     }
 
 private:
@@ -86,7 +159,7 @@ private:
         // Attack/Release presets
         // Both modes: RMS Size=0 (peak), Auto Make-up=NO, Output=0dB, Character=Compress (NO limit)
         float attackMS, releaseMS, ratioValue;
-        if (arMode == Fast)
+        if (config.arMode == Fast)
         {
             attackMS = 0.2f;
             releaseMS = 40.0f;
@@ -99,14 +172,23 @@ private:
             ratioValue = 2.5f;  // Normal mode: Ratio 2.5:1
         }
 
-        compressor.setParameters (thresholdDB, ratioValue, attackMS, releaseMS);
+        hot.compressor.setParameters (config.thresholdDB, ratioValue, attackMS, releaseMS);
     }
 
     //==============================================================================
-    DigitalVersatileCompressor compressor;
+    struct HotState
+    {
+        DigitalVersatileCompressor compressor;
+    };
+
+    struct Config
+    {
+        float thresholdDB = -10.0f;  // Default threshold
+        ARMode arMode = Normal;       // Default: Normal A/R
+    };
 
-    float thresholdDB = -10.0f;  // Default threshold
-    ARMode arMode = Normal;       // Default: Normal A/R
+    HotState hot;
+    Config config;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ControlCompSection)
 };
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "BypassableSection.h"
+#include "../ParameterSnapshot.h"
 #include "../Algorithms/BellFilter.h"
 #include "../Algorithms/Baxandall2.h"
 
@@ -30,15 +31,18 @@ public:
     {
         BypassableSection::setSampleRate (sampleRate);
         baxandall.setSampleRate (sampleRate);
-        bell1.setSampleRate (sampleRate);
-        bell2.setSampleRate (sampleRate);
+        baxandallFloat.setSampleRate (sampleRate);
+        hot.bell1.setSampleRate (sampleRate);
+        hot.bell2.setSampleRate (sampleRate);
     }
 
     void reset() override
     {
         baxandall.reset();
-        bell1.reset();
-        bell2.reset();
+        baxandallFloat.reset();
+        hot.bell1.reset();
+        hot.bell2.reset();
+        config.denormalOffset.reset();
     }
 
     //==============================================================================
@@ -48,7 +52,10 @@ public:
     */
     void setBassShelf (float dB)
     {
-        baxandall.setBass (dB);
+        if (hot.ecoPrecision)
+            baxandallFloat.setBass (dB);
+        else
+            baxandall.setBass (dB);
     }
 
     /**
@@ -57,7 +64,10 @@ public:
     */
     void setTrebleShelf (float dB)
     {
-        baxandall.setTreble (dB);
+        if (hot.ecoPrecision)
+            baxandallFloat.setTreble (dB);
+        else
+            baxandall.setTreble (dB);
     }
 
     /**
@@ -66,7 +76,10 @@ public:
     */
     void setBassShelfFreq (float hz)
     {
-        baxandall.setBassFreq (hz);
+        if (hot.ecoPrecision)
+            baxandallFloat.setBassFreq (hz);
+        else
+            baxandall.setBassFreq (hz);
     }
 
     /**
@@ -75,7 +88,28 @@ public:
     */
     void setTrebleShelfFreq (float hz)
     {
-        baxandall.setTrebleFreq (hz);
+        if (hot.ecoPrecision)
+            baxandallFloat.setTrebleFreq (hz);
+        else
+            baxandall.setTrebleFreq (hz);
+    }
+
+    /**
+        Switches the shelves between Baxandall2 and Baxandall2Float. The
+        incoming instance takes over the settings and filter memory, so the
+        switch is seamless. The bells are float either way.
+    */
+    void setEcoPrecision (bool shouldUseFloat)
+    {
+        if (shouldUseFloat == hot.ecoPrecision)
+            return;
+
+        if (shouldUseFloat)
+            baxandallFloat.copyStateFrom (baxandall);
+        else
+            baxandall.copyStateFrom (baxandallFloat);
+
+        hot.ecoPrecision = shouldUseFloat;
     }
 
     /**
@@ -86,7 +120,7 @@ public:
     void setBell1 (int freqIndex, float gainDB)
     {
         float freq = getFrequencyFromIndex (freqIndex);
-        bell1.setParameters (freq, gainDB);
+        hot.bell1.setParameters (freq, gainDB);
     }
 
     /**
@@ -97,7 +131,7 @@ public:
     void setBell2 (int freqIndex, float gainDB)
     {
         float freq = getFrequencyFromIndex (freqIndex);
-        bell2.setParameters (freq, gainDB);
+        hot.bell2.setParameters (freq, gainDB);
     }
 
     /**
@@ -111,8 +145,8 @@ public:
     void setBell1WithVariation (int freqIndex, float gainDB, float freqOffset, float gainOffset, float qOffset)
     {
         float baseFreq = getFrequencyFromIndex (freqIndex);
-        bell1.setParameters (baseFreq + freqOffset, gainDB + gainOffset);
-        bell1.setQOffset (qOffset);
+        hot.bell1.setParameters (baseFreq + freqOffset, gainDB + gainOffset);
+        hot.bell1.setQOffset (qOffset);
     }
 
     /**
@@ -126,29 +160,99 @@ public:
     void setBell2WithVariation (int freqIndex, float gainDB, float freqOffset, float gainOffset, float qOffset)
     {
         float baseFreq = getFrequencyFromIndex (freqIndex);
-        bell2.setParameters (baseFreq + freqOffset, gainDB + gainOffset);
-        bell2.setQOffset (qOffset);
+        hot.bell2.setParameters (baseFreq + freqOffset, gainDB + gainOffset);
+        hot.bell2.setQOffset (qOffset);
+    }
+
+    /**
+        Applies the EQ fields of the block's parameter snapshot plus the channel
+        variation offsets. Each shelf and bell recomputes its coefficients only
+        when one of its own fields (or the variation preset) changed. The
+        precision switch comes first, so the setters reach the active shelves.
+    */
+    void applyParameters (const ParameterSnapshot& params, const ChannelVariationPreset& variation)
+    {
+        using P = ParameterSnapshot;
+        const bool variationChanged = params.hasChanged (P::channelVariationFields);
+
+        if (params.hasChanged (P::mask (P::EcoPrecision)))
+            setEcoPrecision (params.getBool (P::EcoPrecision));
+
+        if (variationChanged || params.hasChanged (P::mask (P::EqBass)))
+            setBassShelf (params[P::EqBass] + variation.eqBassGain);
+        if (variationChanged || params.hasChanged (P::mask (P::EqBassFreq)))
+            setBassShelfFreq (params[P::EqBassFreq] + variation.eqBassFreq);
+        if (variationChanged || params.hasChanged (P::mask (P::EqTreble)))
+            setTrebleShelf (params[P::EqTreble] + variation.eqTrebleGain);
+        if (variationChanged || params.hasChanged (P::mask (P::EqTrebleFreq)))
+            setTrebleShelfFreq (params[P::EqTrebleFreq] + variation.eqTrebleFreq);
+
+        if (variationChanged || params.hasChanged (P::mask (P::EqBell1Freq, P::EqBell1Gain)))
+            setBell1WithVariation (params.getChoice (P::EqBell1Freq), params[P::EqBell1Gain],
+                                   variation.eqBell1Freq, variation.eqBell1Gain, variation.eqBell1Q);
+        if (variationChanged || params.hasChanged (P::mask (P::EqBell2Freq, P::EqBell2Gain)))
+            setBell2WithVariation (params.getChoice (P::EqBell2Freq), params[P::EqBell2Gain],
+                                   variation.eqBell2Freq, variation.eqBell2Gain, variation.eqBell2Q);
+
+        if (params.hasChanged (P::mask (P::EqBypass)))
+            setBypass (params.getBool (P::EqBypass));
+
+        // Once per block: the shelves are an Airwindows port (DenormalPolicy.h)
+        hot.shelfInputOffset = config.denormalOffset.next();
     }
 
+    /**
+        Multiplies the section's magnitude response (shelves and bells, as set)
+        into magnitudes; unity while bypassed. Only for a private instance (the
+        GUI's response curve), never the one the audio thread runs.
+    */
+    void multiplyMagnitudeResponse (const BiquadResponse& response, double* magnitudes) const
+    {
+        if (isBypassed())
+            return;
+
+        if (hot.ecoPrecision)
+            baxandallFloat.multiplyMagnitudeResponse (response, magnitudes);
+        else
+            baxandall.multiplyMagnitudeResponse (response, magnitudes);
+
+        hot.bell1.multiplyMagnitudeResponse (response, magnitudes);
+        hot.bell2.multiplyMagnitudeResponse (response, magnitudes);
+    }
+
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
+
 protected:
     //==============================================================================
     float processInternal (float input) override
     {
-        float output = input;
+        return processSample (input);
+    }
 
-        // Baxandall2 processes both bass and treble together
-        output = baxandall.process (output);
+    double processInternalDouble (double input) override
+    {
+        return processSample (input);
+    }
 
-        // Bell 1
-        output = bell1.process (output);
+private:
+    //==============================================================================
+    template <typename SampleType>
+    SampleType processSample (SampleType input)
+    {
+        // Baxandall2 processes both bass and treble together (in double, or float in eco precision)
+        input += static_cast<SampleType> (hot.shelfInputOffset);
+        SampleType output = hot.ecoPrecision ? baxandallFloat.process (input) : baxandall.process (input);
 
-        // Bell 2
-        output = bell2.process (output);
+        // Bell 1 and 2 (float biquads)
+        float bells = hot.bell1.process (static_cast<float> (output));
+        bells = hot.bell2.process (bells);
 
-        return output;
+        return static_cast<SampleType> (bells);
     }
 
-private:
     //==============================================================================
     /**
         Convert frequency index to actual frequency in Hz.
@@ -166,8 +270,25 @@ private:
     }
 
     //==============================================================================
+    struct HotState
+    {
+        float shelfInputOffset = 0.0f;
+        bool ecoPrecision = false;  // Selects the shelf instance per sample
+        BellFilter bell1, bell2;
+    };
+
+    struct Config
+    {
+        Denormals::BlockOffset denormalOffset;  // Stepped once per block
+    };
+
+    HotState hot;
+
+    // Only the active shelf instance is touched (and receives settings)
     Baxandall2 baxandall;
-    BellFilter bell1, bell2;
+    Baxandall2Float baxandallFloat;
+
+    Config config;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EQSection)
 };
@@ -15,6 +15,8 @@
 #pragma once
 
 #include "BypassableSection.h"
+#include "../ParameterSnapshot.h"
+#include "../Algorithms/BiquadResponse.h"
 #include <cmath>
 
 //==============================================================================
@@ -44,19 +46,19 @@ public:
     {
         BypassableSection::setSampleRate (sampleRate);
 
-        hpf1.reset();
-        hpf2.reset();
-        lpf1.reset();
+        hot.hpf1.reset();
+        hot.hpf2.reset();
+        hot.lpf1.reset();
 
         updateFilters();
     }
 
     void reset() override
     {
-        hpf1.reset();
-        hpf2.reset();
-        lpf1.reset();
-        lpf2.reset();
+        hot.hpf1.reset();
+        hot.hpf2.reset();
+        hot.lpf1.reset();
+        hot.lpf2.reset();
     }
 
     //==============================================================================
@@ -68,9 +70,9 @@ public:
     */
     void setHPF (float freqHz, Slope slope, QMode qMode)
     {
-        hpfFreq = freqHz;
-        hpfSlope = slope;
-        hpfQMode = qMode;
+        config.hpfFreq = freqHz;
+        config.hpfSlope = slope;
+        config.hpfQMode = qMode;
         updateFilters();
     }
 
@@ -82,9 +84,9 @@ public:
     */
     void setLPF (float freqHz, Slope slope, QMode qMode)
     {
-        lpfFreq = freqHz;
-        lpfSlope = slope;
-        lpfQMode = qMode;
+        config.lpfFreq = freqHz;
+        config.lpfSlope = slope;
+        config.lpfQMode = qMode;
         updateFilters();
     }
 
@@ -94,7 +96,7 @@ public:
     */
     void setHPFQOffset (float offset)
     {
-        hpfQOffset = offset;
+        config.hpfQOffset = offset;
         updateFilters();
     }
 
@@ -104,10 +106,63 @@ public:
     */
     void setLPFQOffset (float offset)
     {
-        lpfQOffset = offset;
+        config.lpfQOffset = offset;
         updateFilters();
     }
 
+    /**
+        Applies the filter fields of the block's parameter snapshot plus the
+        channel variation offsets. Any change to either filter (or to the
+        variation preset) costs one coefficient update.
+    */
+    void applyParameters (const ParameterSnapshot& params, const ChannelVariationPreset& variation)
+    {
+        using P = ParameterSnapshot;
+
+        if (params.hasChanged (P::mask (P::HpfFreq, P::HpfSlope, P::HpfQ, P::LpfFreq, P::LpfSlope, P::LpfQ)
+                               | P::channelVariationFields))
+        {
+            config.hpfFreq = params[P::HpfFreq] + variation.hpfFreq;
+            config.hpfSlope = params.getBool (P::HpfSlope) ? Slope_18dB : Slope_12dB;
+            config.hpfQMode = params.getBool (P::HpfQ) ? Bump : Normal;
+            config.hpfQOffset = variation.hpfQ;
+
+            config.lpfFreq = params[P::LpfFreq] + variation.lpfFreq;
+            config.lpfSlope = params.getBool (P::LpfSlope) ? Slope_12dB : Slope_6dB;
+            config.lpfQMode = params.getBool (P::LpfQ) ? Bump : Normal;
+            config.lpfQOffset = variation.lpfQ;
+
+            updateFilters();
+        }
+
+        if (params.hasChanged (P::mask (P::FiltersBypass)))
+            setBypass (params.getBool (P::FiltersBypass));
+    }
+
+    /**
+        Multiplies the HPF / LPF magnitude response (including the cascades)
+        into magnitudes; unity while bypassed. Only for a private instance (the
+        GUI's response curve), never the one the audio thread runs.
+    */
+    void multiplyMagnitudeResponse (const BiquadResponse& response, double* magnitudes) const
+    {
+        if (isBypassed() || hot.hpf1.coefficients == nullptr || hot.lpf1.coefficients == nullptr)
+            return;
+
+        response.multiplyMagnitude (*hot.hpf1.coefficients, magnitudes);
+        if (config.hpfSlope == Slope_18dB)
+            response.multiplyMagnitude (*hot.hpf2.coefficients, magnitudes);
+
+        response.multiplyMagnitude (*hot.lpf1.coefficients, magnitudes);
+        if (config.lpfSlope == Slope_12dB)
+            response.multiplyMagnitude (*hot.lpf2.coefficients, magnitudes);
+    }
+
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
+
 protected:
     //==============================================================================
     float processInternal (float input) override
@@ -115,14 +170,14 @@ protected:
         float output = input;
 
         // High-pass filter(s)
-        output = hpf1.processSample (output);
-        if (hpfSlope == Slope_18dB)
-            output = hpf2.processSample (output);  // Cascade for 18dB/oct
+        output = hot.hpf1.processSample (output);
+        if (hot.hpfCascade)
+            output = hot.hpf2.processSample (output);  // Cascade for 18dB/oct
 
         // Low-pass filter(s)
-        output = lpf1.processSample (output);
-        if (lpfSlope == Slope_12dB)
-            output = lpf2.processSample (output);  // Cascade for 12dB/oct (FIXED)
+        output = hot.lpf1.processSample (output);
+        if (hot.lpfCascade)
+            output = hot.lpf2.processSample (output);  // Cascade for 12dB/oct (FIXED)
 
         return output;
     }
@@ -214,14 +269,17 @@ private:
 
     void updateFilters()
     {
+        hot.hpfCascade = (config.hpfSlope == Slope_18dB);
+        hot.lpfCascade = (config.lpfSlope == Slope_12dB);
+
         if (currentSampleRate <= 0.0)
             return;
 
         // HPF Q value
-        float hpfQ = (hpfQMode == Normal) ? 0.707f : 1.0f;  // Butterworth Q for natural response
+        float hpfQ = (config.hpfQMode == Normal) ? 0.707f : 1.0f;  // Butterworth Q for natural response
 
         // Apply channel variation HPF Q offset
-        hpfQ += hpfQOffset;
+        hpfQ += config.hpfQOffset;
 
         // Clamp Q to reasonable range to avoid instability
         hpfQ = juce::jlimit (0.1f, 5.0f, hpfQ);
@@ -229,21 +287,21 @@ private:
         // Create HPF coefficients using Matched-Z Transform (12 dB/oct base, cascade for 18 dB/oct)
         auto hpfCoeffs = makeMatchedHighPass (
             currentSampleRate,
-            juce::jlimit (20.0, currentSampleRate * 0.49, static_cast<double>(hpfFreq)),
+            juce::jlimit (20.0, currentSampleRate * 0.49, static_cast<double>(config.hpfFreq)),
             hpfQ);
 
-        hpf1.coefficients = hpfCoeffs;
-        hpf2.coefficients = hpfCoeffs;  // Same coefficients for cascade
+        hot.hpf1.coefficients = hpfCoeffs;
+        hot.hpf2.coefficients = hpfCoeffs;  // Same coefficients for cascade
 
         // LPF Q value
-        float lpfQ = (lpfQMode == Normal) ? 0.707f : 1.0f;
+        float lpfQ = (config.lpfQMode == Normal) ? 0.707f : 1.0f;
 
         // For 6 dB/oct: use lower Q for gentler slope
-        if (lpfSlope == Slope_6dB)
+        if (config.lpfSlope == Slope_6dB)
             lpfQ = 0.5f;
 
         // Apply channel variation LPF Q offset
-        lpfQ += lpfQOffset;
+        lpfQ += config.lpfQOffset;
 
         // Clamp Q to reasonable range to avoid instability
         lpfQ = juce::jlimit (0.1f, 5.0f, lpfQ);
@@ -251,30 +309,42 @@ private:
         // Create LPF coefficients using Matched-Z Transform
         auto lpfCoeffs = makeMatchedLowPass (
             currentSampleRate,
-            juce::jlimit (20.0, currentSampleRate * 0.49, static_cast<double>(lpfFreq)),
+            juce::jlimit (20.0, currentSampleRate * 0.49, static_cast<double>(config.lpfFreq)),
             lpfQ);
 
-        lpf1.coefficients = lpfCoeffs;
-        lpf2.coefficients = lpfCoeffs;  // Same coefficients for cascade
+        hot.lpf1.coefficients = lpfCoeffs;
+        hot.lpf2.coefficients = lpfCoeffs;  // Same coefficients for cascade
     }
 
     //==============================================================================
-    // Filter parameters
-    float hpfFreq = 20.0f;
-    Slope hpfSlope = Slope_12dB;
-    QMode hpfQMode = Normal;
-
-    float lpfFreq = 24000.0f;
-    Slope lpfSlope = Slope_6dB;
-    QMode lpfQMode = Normal;
-
-    // Channel variation Q offsets
-    float hpfQOffset = 0.0f;  // ±0.06
-    float lpfQOffset = 0.0f;  // ±0.06
-
-    // IIR filters
-    juce::dsp::IIR::Filter<float> hpf1, hpf2;  // HPF: use 2 for 18dB/oct cascade
-    juce::dsp::IIR::Filter<float> lpf1, lpf2;  // LPF: use 2 for 12dB/oct cascade
+    struct HotState
+    {
+        // IIR filters
+        juce::dsp::IIR::Filter<float> hpf1, hpf2;  // HPF: use 2 for 18dB/oct cascade
+        juce::dsp::IIR::Filter<float> lpf1, lpf2;  // LPF: use 2 for 12dB/oct cascade
+
+        bool hpfCascade = false;  // Slope_18dB, set by updateFilters()
+        bool lpfCascade = false;  // Slope_12dB
+    };
+
+    struct Config
+    {
+        // Filter parameters
+        float hpfFreq = 20.0f;
+        Slope hpfSlope = Slope_12dB;
+        QMode hpfQMode = Normal;
+
+        float lpfFreq = 24000.0f;
+        Slope lpfSlope = Slope_6dB;
+        QMode lpfQMode = Normal;
+
+        // Channel variation Q offsets
+        float hpfQOffset = 0.0f;  // ±0.06
+        float lpfQOffset = 0.0f;  // ±0.06
+    };
+
+    HotState hot;
+    Config config;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FilterSection)
 };
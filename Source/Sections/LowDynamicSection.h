@@ -19,6 +19,9 @@
 
     Knee: 0.5dB hard knee for precise threshold response
 
+    Above ~72kHz the detectors and gain envelope run decimated
+    (see SidechainDecimator.h); the gain is interpolated back to full rate.
+
     Note: Attack/Release semantics for expander are inverted from compressor:
     - Recovery (fast) = returning to unity gain when signal goes above threshold
     - Reduction (slow) = reducing gain when signal stays below threshold
@@ -29,6 +32,8 @@
 #pragma once
 
 #include "../Sections/BypassableSection.h"
+#include "../Algorithms/SidechainDecimator.h"
+#include "../ParameterSnapshot.h"
 #include <JuceHeader.h>
 #include <cmath>
 
@@ -39,14 +44,16 @@ public:
 
     void setSampleRate (double sr) override
     {
-        sampleRate = sr;
+        BypassableSection::setSampleRate (sr);  // Bypass crossfade length
+        hot.decimator.setSampleRate (sr);
+        config.sampleRate = hot.decimator.getDetectorSampleRate (sr);  // Detector and envelope rate
         updateTimingCoefficients();
 
         // CRITICAL: Initialize state to prevent initial gain spike
         resetState();
 
         // Initialize smoothedGain to 1.0 (unity) to avoid spike
-        smoothedGain = 1.0f;
+        hot.smoothedGain = 1.0f;
     }
 
     void reset() override
@@ -57,187 +64,275 @@ public:
     // Parameters
     void setThreshold (float thresholdDB)
     {
-        threshold = thresholdDB;
+        hot.threshold = thresholdDB;
     }
 
     void setRatio (float ratioValue)  // -10 to +10
     {
-        ratio = ratioValue;
+        hot.ratio = ratioValue;
     }
 
     void setFastMode (bool isFast)
     {
-        fastMode = isFast;
+        hot.fastMode = isFast;
         updateTimingCoefficients();
     }
 
     void setMix (float percent)
     {
-        mixPercent = juce::jlimit (0.0f, 100.0f, percent);
-        mixAmount = mixPercent / 100.0f;
+        config.mixPercent = juce::jlimit (0.0f, 100.0f, percent);
+        hot.mixAmount = config.mixPercent / 100.0f;
+    }
+
+    // Applies the Low Dynamic fields of the block's parameter snapshot (changed fields only)
+    void applyParameters (const ParameterSnapshot& params)
+    {
+        using P = ParameterSnapshot;
+
+        if (params.hasChanged (P::mask (P::LowDynThresh)))
+            setThreshold (params[P::LowDynThresh]);
+        if (params.hasChanged (P::mask (P::LowDynRatio)))
+            setRatio (params[P::LowDynRatio]);
+        if (params.hasChanged (P::mask (P::LowDynFast)))
+            setFastMode (params.getBool (P::LowDynFast));
+        if (params.hasChanged (P::mask (P::LowDynMix)))
+            setMix (params[P::LowDynMix]);
+
+        // CRITICAL: Bypass parameter is 1.0 when button is ON (bypassed)
+        if (params.hasChanged (P::mask (P::LowDynBypass)))
+            setBypass (params.getBool (P::LowDynBypass));
+
+        // Keep the envelope moving while bypassed so re-engaging doesn't pump
+        if (params.hasChanged (P::mask (P::DetectorsWhileBypassed)))
+            setDetectorsRunWhileBypassed (params.getBool (P::DetectorsWhileBypassed));
     }
 
     // Get current gain reduction (for metering, if needed)
     float getCurrentGainReduction() const
     {
-        return currentGR;
+        return hot.currentGR;
     }
 
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
+
 protected:
     float processInternal (float input) override
     {
         // CRITICAL: If ratio is near zero, bypass completely (no processing)
-        if (std::abs(ratio) < 0.01f)
+        if (std::abs(hot.ratio) < 0.01f)
         {
             // Reset gain to unity to prevent any residual gain
-            smoothedGain = 1.0f;
-            currentGR = 0.0f;
+            hot.smoothedGain = 1.0f;
+            hot.currentGR = 0.0f;
+            hot.decimator.reset();
             return input;
         }
 
+        // === STEP 4: APPLY SMOOTHED GAIN TO ORIGINAL INPUT ===
+        // CRITICAL: We apply the smoothed envelope to the ORIGINAL input,
+        // NOT to the detected level. This preserves transients above threshold.
+        float wet = input * getNextGain (input);
+
+        // === STEP 5: MIX DRY AND WET ===
+        // mixAmount: 0.0 = 100% dry (bypass), 1.0 = 100% wet (full effect)
+        float output = input * (1.0f - hot.mixAmount) + wet * hot.mixAmount;
+
+        return output;
+    }
+
+    void processInternalBlock (float* data, int numSamples) override
+    {
+        processMixedBlock (data, numSamples);
+    }
+
+    void processInternalBlockDouble (double* data, int numSamples) override
+    {
+        processMixedBlock (data, numSamples);
+    }
+
+    int getNumSectionScratchBlocks() const override
+    {
+        return 1;  // Dry copy
+    }
+
+    //==============================================================================
+    // Control-rate detector while bypassed: RMS/peak detectors and gain envelope
+    // are stepped once per block (closed form for a constant block level)
+    void updateDetectorsWhileBypassed (const float* input, int numSamples) override
+    {
+        if (std::abs(hot.ratio) < 0.01f || numSamples <= 0)
+            return;
+
+        const float sumSquares = BlockKernels::sumOfSquares(input, numSamples);
+        const float peak = BlockKernels::findPeak(input, numSamples);
+
+        // Detector steps in this block (the detectors may run decimated)
+        const float n = static_cast<float>(numSamples) / static_cast<float>(hot.decimator.getFactor());
+        const float meanSquare = sumSquares / static_cast<float>(numSamples);
+
+        hot.rmsState = meanSquare + (hot.rmsState - meanSquare) * std::pow(hot.rmsCoeff, n);
+        hot.peakHold = std::max(peak, hot.peakHold * std::pow(hot.peakHoldDecay, n));
+        hot.warmupSamplesRemaining = std::max(0, hot.warmupSamplesRemaining - numSamples);
+
+        // Gate on the block RMS (the per-sample instant level isn't available here)
+        float levelDB = 20.0f * std::log10(std::max(std::sqrt(meanSquare), 1e-6f));
+        float targetGainLinear = std::pow(10.0f, computeTargetGainDB (levelDB) / 20.0f);
+
+        float coeff;
+        if (hot.ratio < 0.0f)
+            coeff = (targetGainLinear < hot.smoothedGain) ? hot.releaseCoeff : hot.attackCoeff;
+        else
+            coeff = (targetGainLinear > hot.smoothedGain) ? hot.lifterReleaseCoeff : hot.lifterAttackCoeff;
+
+        hot.smoothedGain = targetGainLinear + std::pow(coeff, n) * (hot.smoothedGain - targetGainLinear);
+        hot.currentGR = 20.0f * std::log10(std::max(hot.smoothedGain, 1e-6f));
+        hot.decimator.reset (hot.smoothedGain);
+    }
+
+private:
+    /** Gain for the next sample (steps 1-3: detector and gain envelope). */
+    float getNextGain (float input)
+    {
+        // === STEPS 1-3: DETECTOR AND GAIN ENVELOPE ===
+        // Per sample, or once per group of samples at high sample rates (the
+        // group peak keeps the instant gating, the mean square feeds the RMS)
+        float gainToApply;
+        if (hot.decimator.isDecimating())
+        {
+            if (hot.decimator.push (input))
+            {
+                const float groupPeak = std::abs (hot.decimator.getPeak());
+                hot.decimator.setTargetGain (updateGain (groupPeak, hot.decimator.getMeanSquare()));
+            }
+
+            gainToApply = hot.decimator.getNextGain();
+        }
+        else
+        {
+            gainToApply = updateGain (std::abs(input), input * input);
+        }
+
+        return gainToApply;
+    }
+
+    /** Block path: dry copy in scratch, vector mix (the envelope runs per sample). */
+    template <typename SampleType>
+    void processMixedBlock (SampleType* data, int numSamples)
+    {
+        // Ratio off: per sample, as before (resets the envelope, passes the input)
+        if (std::abs(hot.ratio) < 0.01f)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                data[i] = static_cast<SampleType> (processInternal (static_cast<float> (data[i])));
+
+            return;
+        }
+
+        auto processWetChunk = [this] (SampleType* chunk, int num)
+        {
+            for (int i = 0; i < num; ++i)
+            {
+                const float input = static_cast<float> (chunk[i]);
+                chunk[i] = static_cast<SampleType> (input * getNextGain (input));
+            }
+        };
+
+        // Fully wet: no dry copy needed
+        if (hot.mixAmount >= 1.0f)
+            processWetChunk (data, numSamples);
+        else
+            processWithDryMix (data, numSamples, hot.mixAmount, processWetChunk);
+    }
+
+    /**
+        Sidechain detection, gain computer and attack/release envelope (one step).
+        @param instantLevel absolute level for threshold gating
+        @param inputSquared squared input for the RMS detector
+        @return the smoothed gain
+    */
+    float updateGain (float instantLevel, float inputSquared)
+    {
         // === STEP 1: SIDECHAIN LEVEL DETECTION ===
         // CRITICAL FIX: Use INSTANT level for threshold gating to prevent
         // false triggering on peaks above threshold. RMS is only used for
         // smooth gain calculation, NOT for threshold comparison.
 
         // Instant level (for threshold gating)
-        float instantLevel = std::abs(input);
         float instantDB = 20.0f * std::log10(std::max(instantLevel, 1e-6f));
 
         // Smoothed detector level (for smooth gain calculation)
         float detectorLevel;
-        if (fastMode)
+        if (hot.fastMode)
         {
             // FAST MODE: Peak hold for expander ONLY, RMS for lifter
-            if (ratio < 0.0f)
+            if (hot.ratio < 0.0f)
             {
                 // Expander: Peak detection with hold (prevents rapid fluctuations)
                 float currentPeak = instantLevel;
 
                 // Update peak hold: instant attack, slow decay
-                if (currentPeak > peakHold)
-                    peakHold = currentPeak;  // Instant attack
+                if (currentPeak > hot.peakHold)
+                    hot.peakHold = currentPeak;  // Instant attack
                 else
-                    peakHold = currentPeak + peakHoldDecay * (peakHold - currentPeak);  // Slow decay
+                    hot.peakHold = currentPeak + hot.peakHoldDecay * (hot.peakHold - currentPeak);  // Slow decay
 
-                detectorLevel = peakHold;
+                detectorLevel = hot.peakHold;
             }
             else
             {
                 // Lifter: Use RMS to avoid peak hold interference
-                float inputSquared = input * input;
-                rmsState = rmsState * rmsCoeff + inputSquared * (1.0f - rmsCoeff);
-                detectorLevel = std::sqrt(rmsState);
+                hot.rmsState = hot.rmsState * hot.rmsCoeff + inputSquared * (1.0f - hot.rmsCoeff);
+                detectorLevel = std::sqrt(hot.rmsState);
             }
         }
         else
         {
             // NORMAL MODE: RMS detection (longer window ~20ms for stability)
-            float inputSquared = input * input;
-            rmsState = rmsState * rmsCoeff + inputSquared * (1.0f - rmsCoeff);
-            detectorLevel = std::sqrt(rmsState);
+            hot.rmsState = hot.rmsState * hot.rmsCoeff + inputSquared * (1.0f - hot.rmsCoeff);
+            detectorLevel = std::sqrt(hot.rmsState);
         }
 
         // Note: detectorLevel is smoothed for visual metering, but we use instantDB for threshold gating
 
         // === STEP 2: COMPUTE TARGET GAIN ===
-        float targetGainDB = 0.0f;  // Default: no change
-
         // CRITICAL: Use INSTANT level for threshold gating (prevents false triggering)
-        if (instantDB < threshold)
-        {
-            // Gate is open: signal is below threshold
-            // Calculate reduction amount based on INSTANT level (must use same reference!)
-            // Using detectorDB here could give negative dbBelowThreshold if smoothed level > threshold
-            float dbBelowThreshold = threshold - instantDB;
-
-            // Safety clamp: ensure dbBelowThreshold is always positive
-            dbBelowThreshold = std::max(dbBelowThreshold, 0.0f);
-
-            if (ratio < 0.0f)
-            {
-                // DOWNWARD EXPANSION: Reduce signal below threshold
-                // PROGRESSIVE SCALING: knob -1 = 1:1.02, knob -10 = 1:4
-                // Using quadratic curve for more control at low ratios
-                float absRatio = std::abs(ratio);
-                float normalizedRatio = absRatio / 10.0f;  // 0 to 1
-
-                // Quadratic scaling: ratio = 1 + (normalized^2) * 3.0
-                // -1  → 1 + (0.1^2) * 3.0 = 1 + 0.03 = 1.03  (close to 1:1.02) ✓
-                // -5  → 1 + (0.5^2) * 3.0 = 1 + 0.75 = 1.75  (moderate)
-                // -10 → 1 + (1.0^2) * 3.0 = 1 + 3.0  = 4.0   (1:4 max) ✓
-                float expansionRatio = 1.0f + (normalizedRatio * normalizedRatio * 3.0f);
-
-                // Slope: for 1:4 ratio, slope = 3.0
-                float slope = expansionRatio - 1.0f;
-                targetGainDB = -dbBelowThreshold * slope;  // Negative (reduction)
-
-                // Safety limiter: prevent digital silence (clamp to -96 dB max reduction)
-                targetGainDB = std::max(targetGainDB, -96.0f);
-
-                // Mathematical verification:
-                // Input 20dB below threshold, ratio -10 (1:4):
-                // slope = 3.0, targetGainDB = -20 * 3.0 = -60 dB
-                // Output: -80 dB below threshold → 80/20 = 4:1 ratio ✓
-            }
-            else if (ratio > 0.0f)
-            {
-                // UPWARD COMPRESSION: Boost signal below threshold
-                // Scaling: knob +10 = ratio 1:4
-                // liftAmount = 0.75 → for 20dB below threshold: boost = 15dB → output 5dB below = 1:4 ratio
-                float liftAmount = ratio * 0.075f;  // 0 to 0.75 (ratio 1:1 to 1:4)
-                targetGainDB = dbBelowThreshold * liftAmount;  // Positive (boost)
-
-                // Mathematical verification:
-                // Input 20dB below threshold, ratio +10 (1:4):
-                // liftAmount = 0.75, targetGainDB = 20 * 0.75 = +15 dB
-                // Output: -20 + 15 = -5 dB below threshold → 20/5 = 4:1 → 1:4 ratio ✓
-            }
-
-            // Hard knee (0.5 dB transition around threshold)
-            // Applies quadratic curve near threshold to soften the transition
-            const float kneeWidth = 0.5f;
-            if (dbBelowThreshold < kneeWidth)
-            {
-                float kneeRatio = dbBelowThreshold / kneeWidth;
-                targetGainDB *= (kneeRatio * kneeRatio);  // Smooth curve
-            }
-        }
-        // If instantDB >= threshold: targetGainDB = 0.0 (no processing)
-        // This ensures peaks above threshold are NEVER affected
+        float targetGainDB = computeTargetGainDB (instantDB);
 
         // === STEP 3: SMOOTH TARGET GAIN WITH ATTACK/RELEASE ===
         // This creates the envelope follower
         float targetGainLinear = std::pow(10.0f, targetGainDB / 20.0f);
 
         // Determine mode early for initialization
-        bool isExpanding = (ratio < 0.0f);
-        bool isLifting = (ratio > 0.0f);
+        bool isExpanding = (hot.ratio < 0.0f);
+        bool isLifting = (hot.ratio > 0.0f);
 
         // CRITICAL: Detector warmup protection OR detector cold check
         // Limit gain if either in warmup period OR detectors are cold
-        bool detectorsAreCold = (warmupSamplesRemaining > 0) || (detectorLevel < 1e-6f);
+        bool detectorsAreCold = (hot.warmupSamplesRemaining > 0) || (detectorLevel < 1e-6f);
 
         if (detectorsAreCold)
         {
-            if (warmupSamplesRemaining > 0)
-                warmupSamplesRemaining--;
+            if (hot.warmupSamplesRemaining > 0)
+                hot.warmupSamplesRemaining = std::max(0, hot.warmupSamplesRemaining - hot.decimator.getFactor());
 
             // For lifter: uses lifterAttackCoeff (0.5ms, very fast but not instant)
             // For expander: uses attackCoeff (0.5ms FAST, 15ms NORMAL)
-            float initAttackCoeff = isLifting ? lifterAttackCoeff : attackCoeff;
+            float initAttackCoeff = isLifting ? hot.lifterAttackCoeff : hot.attackCoeff;
 
             // Ramp up gradually using attack coefficient
-            smoothedGain = 1.0f + initAttackCoeff * (targetGainLinear - 1.0f);
+            hot.smoothedGain = 1.0f + initAttackCoeff * (targetGainLinear - 1.0f);
 
             // SAFETY LIMITER: While detectors are cold, clamp gain to +6 dB max
             // This prevents extreme spikes from detector zero state
             const float maxWarmupGain = 2.0f;  // +6 dB max during warmup
-            smoothedGain = std::min(smoothedGain, maxWarmupGain);
+            hot.smoothedGain = std::min(hot.smoothedGain, maxWarmupGain);
 
             // Also clamp for expander (prevent over-reduction)
             const float minWarmupGain = 0.5f;  // -6 dB min during warmup
-            smoothedGain = std::max(smoothedGain, minWarmupGain);
+            hot.smoothedGain = std::max(hot.smoothedGain, minWarmupGain);
         }
         else  // CRITICAL: Only run normal envelope follower when detectors are warmed up!
         {
@@ -263,10 +358,10 @@ protected:
             //   This allows transients to pass through before expansion kicks in
             // - When gain INCREASES (targetGain > smoothed): Use FAST coefficient (release = fast recovery)
             //   This ensures the expander opens quickly when signal goes above threshold
-            if (targetGainLinear < smoothedGain)
-                smoothedGain = targetGainLinear + releaseCoeff * (smoothedGain - targetGainLinear);  // SLOW reduction (attack)
+            if (targetGainLinear < hot.smoothedGain)
+                hot.smoothedGain = targetGainLinear + hot.releaseCoeff * (hot.smoothedGain - targetGainLinear);  // SLOW reduction (attack)
             else
-                smoothedGain = targetGainLinear + attackCoeff * (smoothedGain - targetGainLinear);  // FAST recovery (release)
+                hot.smoothedGain = targetGainLinear + hot.attackCoeff * (hot.smoothedGain - targetGainLinear);  // FAST recovery (release)
         }
         else if (isLifting)
         {
@@ -276,99 +371,172 @@ protected:
             //   This applies lift gradually to avoid pumping
             // - When gain DECREASES (targetGain < smoothed): Use lifterAttackCoeff (FAST)
             //   This ensures quick return to unity gain when transients go above threshold
-            if (targetGainLinear > smoothedGain)
-                smoothedGain = targetGainLinear + lifterReleaseCoeff * (smoothedGain - targetGainLinear);  // SLOW lift
+            if (targetGainLinear > hot.smoothedGain)
+                hot.smoothedGain = targetGainLinear + hot.lifterReleaseCoeff * (hot.smoothedGain - targetGainLinear);  // SLOW lift
             else
-                smoothedGain = targetGainLinear + lifterAttackCoeff * (smoothedGain - targetGainLinear);  // FAST return
+                hot.smoothedGain = targetGainLinear + hot.lifterAttackCoeff * (hot.smoothedGain - targetGainLinear);  // FAST return
         }
         }  // End of else block (normal envelope follower after warmup)
 
-        // === STEP 4: APPLY SMOOTHED GAIN TO ORIGINAL INPUT ===
-        // CRITICAL: We apply the smoothed envelope to the ORIGINAL input,
-        // NOT to the detected level. This preserves transients above threshold.
-        float wet = input * smoothedGain;
-
         // Store current GR for metering
-        currentGR = 20.0f * std::log10(std::max(smoothedGain, 1e-6f));
+        hot.currentGR = 20.0f * std::log10(std::max(hot.smoothedGain, 1e-6f));
 
-        // === STEP 5: MIX DRY AND WET ===
-        // mixAmount: 0.0 = 100% dry (bypass), 1.0 = 100% wet (full effect)
-        float output = input * (1.0f - mixAmount) + wet * mixAmount;
+        return hot.smoothedGain;
+    }
+
+    float computeTargetGainDB (float levelDB) const
+    {
+        float targetGainDB = 0.0f;  // Default: no change
+
+        if (levelDB < hot.threshold)
+        {
+            // Gate is open: signal is below threshold
+            // Calculate reduction amount based on INSTANT level (must use same reference!)
+            // Using detectorDB here could give negative dbBelowThreshold if smoothed level > threshold
+            float dbBelowThreshold = hot.threshold - levelDB;
+
+            // Safety clamp: ensure dbBelowThreshold is always positive
+            dbBelowThreshold = std::max(dbBelowThreshold, 0.0f);
+
+            if (hot.ratio < 0.0f)
+            {
+                // DOWNWARD EXPANSION: Reduce signal below threshold
+                // PROGRESSIVE SCALING: knob -1 = 1:1.02, knob -10 = 1:4
+                // Using quadratic curve for more control at low ratios
+                float absRatio = std::abs(hot.ratio);
+                float normalizedRatio = absRatio / 10.0f;  // 0 to 1
+
+                // Quadratic scaling: ratio = 1 + (normalized^2) * 3.0
+                // -1  → 1 + (0.1^2) * 3.0 = 1 + 0.03 = 1.03  (close to 1:1.02) ✓
+                // -5  → 1 + (0.5^2) * 3.0 = 1 + 0.75 = 1.75  (moderate)
+                // -10 → 1 + (1.0^2) * 3.0 = 1 + 3.0  = 4.0   (1:4 max) ✓
+                float expansionRatio = 1.0f + (normalizedRatio * normalizedRatio * 3.0f);
+
+                // Slope: for 1:4 ratio, slope = 3.0
+                float slope = expansionRatio - 1.0f;
+                targetGainDB = -dbBelowThreshold * slope;  // Negative (reduction)
+
+                // Safety limiter: prevent digital silence (clamp to -96 dB max reduction)
+                targetGainDB = std::max(targetGainDB, -96.0f);
+
+                // Mathematical verification:
+                // Input 20dB below threshold, ratio -10 (1:4):
+                // slope = 3.0, targetGainDB = -20 * 3.0 = -60 dB
+                // Output: -80 dB below threshold → 80/20 = 4:1 ratio ✓
+            }
+            else if (hot.ratio > 0.0f)
+            {
+                // UPWARD COMPRESSION: Boost signal below threshold
+                // Scaling: knob +10 = ratio 1:4
+                // liftAmount = 0.75 → for 20dB below threshold: boost = 15dB → output 5dB below = 1:4 ratio
+                float liftAmount = hot.ratio * 0.075f;  // 0 to 0.75 (ratio 1:1 to 1:4)
+                targetGainDB = dbBelowThreshold * liftAmount;  // Positive (boost)
+
+                // Mathematical verification:
+                // Input 20dB below threshold, ratio +10 (1:4):
+                // liftAmount = 0.75, targetGainDB = 20 * 0.75 = +15 dB
+                // Output: -20 + 15 = -5 dB below threshold → 20/5 = 4:1 → 1:4 ratio ✓
+            }
+
+            // Hard knee (0.5 dB transition around threshold)
+            // Applies quadratic curve near threshold to soften the transition
+            const float kneeWidth = 0.5f;
+            if (dbBelowThreshold < kneeWidth)
+            {
+                float kneeRatio = dbBelowThreshold / kneeWidth;
+                targetGainDB *= (kneeRatio * kneeRatio);  // Smooth curve
+            }
+        }
+        // If levelDB >= threshold: targetGainDB = 0.0 (no processing)
+        // This ensures peaks above threshold are NEVER affected
+
+        return targetGainDB;
 
-        return output;
     }
 
-private:
-    // Parameters
-    double sampleRate = 44100.0;
-    float threshold = -20.0f;  // dB (range: -40 to -3)
-    float ratio = 0.0f;        // -10 to +10
-    bool fastMode = false;
-
-    // Mix parameters
-    float mixPercent = 100.0f;  // Default: 100% (full wet)
-    float mixAmount = 1.0f;
-
-    // State
-    float rmsState = 0.0f;
-    float smoothedGain = 1.0f;
-    float currentGR = 0.0f;  // Current gain reduction/lift (dB)
-    float peakHold = 0.0f;  // Peak hold for detection (prevents rapid gain changes)
-    float peakHoldDecay = 0.0f;
-    int warmupSamplesRemaining = 0;  // Samples remaining in detector warmup period
-
-    // Coefficients
-    float rmsCoeff = 0.0f;
-    float attackCoeff = 0.0f;
-    float releaseCoeff = 0.0f;
-
-    // Separate coefficients for lifter (faster return to unity in NORMAL mode)
-    float lifterAttackCoeff = 0.0f;   // Same as attackCoeff (0.5ms fast return)
-    float lifterReleaseCoeff = 0.0f;  // Faster in NORMAL mode (15ms instead of 100ms)
+    // Per-sample state and everything the per-sample path reads
+    struct HotState
+    {
+        // State
+        float rmsState = 0.0f;
+        float smoothedGain = 1.0f;
+        float currentGR = 0.0f;  // Current gain reduction/lift (dB)
+        float peakHold = 0.0f;  // Peak hold for detection (prevents rapid gain changes)
+        int warmupSamplesRemaining = 0;  // Samples remaining in detector warmup period
+
+        // Parameters
+        float threshold = -20.0f;  // dB (range: -40 to -3)
+        float ratio = 0.0f;        // -10 to +10
+        float mixAmount = 1.0f;
+        bool fastMode = false;
+
+        // Coefficients
+        float rmsCoeff = 0.0f;
+        float peakHoldDecay = 0.0f;
+        float attackCoeff = 0.0f;
+        float releaseCoeff = 0.0f;
+
+        // Separate coefficients for lifter (faster return to unity in NORMAL mode)
+        float lifterAttackCoeff = 0.0f;   // Same as attackCoeff (0.5ms fast return)
+        float lifterReleaseCoeff = 0.0f;  // Faster in NORMAL mode (15ms instead of 100ms)
+
+        SidechainDecimator decimator;
+    };
+
+    // Settings, only read by the setters and the coefficient update
+    struct Config
+    {
+        double sampleRate = 44100.0;  // Detector rate (session rate / decimation factor)
+        float mixPercent = 100.0f;  // Default: 100% (full wet)
+    };
+
+    HotState hot;
+    Config config;
 
     void updateTimingCoefficients()
     {
-        if (sampleRate <= 0.0)
+        if (config.sampleRate <= 0.0)
             return;
 
         // RMS window (longer for more stable detection ~20ms)
-        rmsCoeff = std::exp(-1.0f / (0.020f * static_cast<float>(sampleRate)));
+        hot.rmsCoeff = std::exp(-1.0f / (0.020f * static_cast<float>(config.sampleRate)));
 
         // Peak hold decay (50ms hold time before decay)
-        peakHoldDecay = std::exp(-1.0f / (0.050f * static_cast<float>(sampleRate)));
+        hot.peakHoldDecay = std::exp(-1.0f / (0.050f * static_cast<float>(config.sampleRate)));
 
-        if (fastMode)
+        if (hot.fastMode)
         {
             // FAST: 0.5ms attack (recovery), 60ms release (reduction)
-            attackCoeff = std::exp(-1.0f / (0.0005f * static_cast<float>(sampleRate)));
-            releaseCoeff = std::exp(-1.0f / (0.060f * static_cast<float>(sampleRate)));
+            hot.attackCoeff = std::exp(-1.0f / (0.0005f * static_cast<float>(config.sampleRate)));
+            hot.releaseCoeff = std::exp(-1.0f / (0.060f * static_cast<float>(config.sampleRate)));
 
             // FAST Lifter: same as expander (60ms is fine for both)
-            lifterAttackCoeff = attackCoeff;    // 0.5ms (fast return to unity)
-            lifterReleaseCoeff = releaseCoeff;  // 60ms (gradual lift)
+            hot.lifterAttackCoeff = hot.attackCoeff;    // 0.5ms (fast return to unity)
+            hot.lifterReleaseCoeff = hot.releaseCoeff;  // 60ms (gradual lift)
         }
         else
         {
             // NORMAL Expander: 15ms attack (recovery), 100ms release (reduction)
-            attackCoeff = std::exp(-1.0f / (0.015f * static_cast<float>(sampleRate)));
-            releaseCoeff = std::exp(-1.0f / (0.100f * static_cast<float>(sampleRate)));
+            hot.attackCoeff = std::exp(-1.0f / (0.015f * static_cast<float>(config.sampleRate)));
+            hot.releaseCoeff = std::exp(-1.0f / (0.100f * static_cast<float>(config.sampleRate)));
 
             // NORMAL Lifter: 0.5ms attack (fast return), 15ms release (faster lift)
             // CRITICAL: Faster return to unity (0.5ms) to preserve transients above threshold
-            lifterAttackCoeff = std::exp(-1.0f / (0.0005f * static_cast<float>(sampleRate)));  // 0.5ms
-            lifterReleaseCoeff = std::exp(-1.0f / (0.015f * static_cast<float>(sampleRate)));  // 15ms
+            hot.lifterAttackCoeff = std::exp(-1.0f / (0.0005f * static_cast<float>(config.sampleRate)));  // 0.5ms
+            hot.lifterReleaseCoeff = std::exp(-1.0f / (0.015f * static_cast<float>(config.sampleRate)));  // 15ms
         }
     }
 
     void resetState()
     {
-        rmsState = 0.0f;
-        smoothedGain = 1.0f;
-        currentGR = 0.0f;
-        peakHold = 0.0f;
+        hot.rmsState = 0.0f;
+        hot.smoothedGain = 1.0f;
+        hot.currentGR = 0.0f;
+        hot.peakHold = 0.0f;
+        hot.decimator.reset();
 
         // Set warmup period: ~100 samples (~2.3ms @ 44.1kHz) for detectors to stabilize
         // During warmup, gain is limited to prevent spike from cold detectors
-        warmupSamplesRemaining = 100;
+        hot.warmupSamplesRemaining = 100;
     }
 };
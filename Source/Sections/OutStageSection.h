@@ -14,6 +14,8 @@
 #pragma once
 
 #include "BypassableSection.h"
+#include "AlgorithmStateSlot.h"
+#include "../ParameterSnapshot.h"
 #include "../Algorithms/PurestDrive.h"
 #include "../Algorithms/ToTape8.h"
 #include "../Algorithms/Tube2.h"
@@ -35,29 +37,84 @@ public:
         Tape = 2,
         Tube = 3,
         HardClip = 4,
-        SoftClip = 5
+        SoftClip = 5,
+        NumAlgorithms
     };
 
-    OutStageSection() = default;
+    OutStageSection()
+    {
+        // Only the selected algorithm's state is allocated (Clean is stateless)
+        algorithmStates.setSlot (Pure, &purestDrive);
+        algorithmStates.setSlot (Tape, &toTape8);
+        algorithmStates.setSlot (Tube, &tube2);
+        algorithmStates.setSlot (HardClip, &finalClip);
+        algorithmStates.setSlot (SoftClip, &clipSoftly);
+
+        algorithmStates.setSlot (PureFloat, &purestDriveFloat);
+        algorithmStates.setSlot (TapeFloat, &toTape8Float);
+        algorithmStates.setSlot (TubeFloat, &tube2Float);
+
+        // Airwindows ports: the per-block denormal offset (DenormalPolicy.h)
+        algorithmStates.setUsesDenormalOffset (true);
+    }
 
     //==============================================================================
     void setSampleRate (double sampleRate) override
     {
         BypassableSection::setSampleRate (sampleRate);
-        purestDrive.setSampleRate (sampleRate);
-        toTape8.setSampleRate (sampleRate);
-        tube2.setSampleRate (sampleRate);
-        finalClip.setSampleRate (sampleRate);
-        clipSoftly.setSampleRate (sampleRate);
+        purestDrive.prepareIfAllocated();
+        toTape8.prepareIfAllocated();
+        tube2.prepareIfAllocated();
+        finalClip.prepareIfAllocated();
+        clipSoftly.prepareIfAllocated();
+        purestDriveFloat.prepareIfAllocated();
+        toTape8Float.prepareIfAllocated();
+        tube2Float.prepareIfAllocated();
+        algorithmStates.setSampleRate (sampleRate);
     }
 
     void reset() override
     {
-        purestDrive.reset();
-        toTape8.reset();
-        tube2.reset();
-        finalClip.reset();
-        clipSoftly.reset();
+        // Only the active algorithm is owned by the audio thread
+        algorithmStates.reset ([this] (int algo) { resetAlgorithm (algo); });
+    }
+
+    //==============================================================================
+    /**
+        Allocates the state for the given algorithm and frees unused ones.
+        Call from the message thread (or prepareToPlay), never from the audio thread.
+    */
+    void updateAlgorithmStates (Algorithm algo, bool useEcoPrecision = false)
+    {
+        algorithmStates.updateAllocations (getStateIndex (algo, useEcoPrecision));
+    }
+
+    /**
+        Allocates the state of every algorithm in the given precision (offline
+        renders, where a switch must not wait for the message thread). Same
+        threading as updateAlgorithmStates(); the next updateAlgorithmStates()
+        frees them.
+    */
+    void allocateAllAlgorithmStates (bool useEcoPrecision)
+    {
+        AlgorithmStateSet<NumStates>::StateMask statesToKeep {};
+
+        for (int algo = 0; algo < NumAlgorithms; ++algo)
+            statesToKeep[static_cast<size_t> (getStateIndex (static_cast<Algorithm> (algo), useEcoPrecision))] = true;
+
+        algorithmStates.updateAllocations (statesToKeep);
+    }
+
+    /** Returns true (once) if updateAlgorithmStates() needs to run on the message thread. */
+    bool needsAlgorithmStateUpdate()
+    {
+        return algorithmStates.checkAndClearUpdateFlag();
+    }
+
+    /** Per-instance memory: section object plus allocated algorithm state. */
+    size_t getStateBytes() const
+    {
+        return sizeof (*this) + algorithmStates.getAllocatedBytes();
     }
 
     //==============================================================================
@@ -67,7 +124,19 @@ public:
     */
     void setAlgorithm (Algorithm algo)
     {
-        currentAlgorithm = algo;
+        config.algorithm = algo;
+        algorithmStates.select (getStateIndex (algo, config.ecoPrecision),
+                                [this] (int a, float x) { return processAlgorithm (a, x); },
+                                [this] (int a) { resetAlgorithm (a); });
+    }
+
+    /**
+        Uses the float variants of the saturators (the clippers have none).
+        Applied by the next setAlgorithm() call.
+    */
+    void setEcoPrecision (bool shouldUseFloat)
+    {
+        config.ecoPrecision = shouldUseFloat;
     }
 
     /**
@@ -76,67 +145,158 @@ public:
     */
     void setDrive (float dB)
     {
-        driveDB = dB;
-        driveLinear = std::pow (10.0f, dB / 20.0f);
+        hot.driveDB = dB;
+        hot.driveLinear = std::pow (10.0f, dB / 20.0f);
+    }
+
+    /** Applies the OutStage fields of the block's parameter snapshot (algorithm every block). */
+    void applyParameters (const ParameterSnapshot& params)
+    {
+        using P = ParameterSnapshot;
+
+        setEcoPrecision (params.getBool (P::EcoPrecision));
+        setAlgorithm (static_cast<Algorithm> (params.getChoice (P::OutStageAlgo)));
+
+        if (params.hasChanged (P::mask (P::OutStageDrive)))
+            setDrive (params[P::OutStageDrive]);
+        if (params.hasChanged (P::mask (P::OutStageBypass)))
+            setBypass (params.getBool (P::OutStageBypass));
     }
 
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
+
 protected:
     //==============================================================================
     float processInternal (float input) override
     {
-        switch (currentAlgorithm)
+        // Runs the active algorithm (crossfaded from the outgoing one after a change).
+        // The active algorithm may briefly lag config.algorithm while the newly
+        // selected algorithm's state is being allocated.
+        return algorithmStates.process (input, [this] (int algo, auto x) { return processAlgorithm (algo, x); });
+    }
+
+    double processInternalDouble (double input) override
+    {
+        return algorithmStates.process (input, [this] (int algo, auto x) { return processAlgorithm (algo, x); });
+    }
+
+private:
+    // Float (eco precision) variants of the saturators, after the regular algorithms
+    enum FloatVariant
+    {
+        PureFloat = NumAlgorithms + Pure,
+        TapeFloat = NumAlgorithms + Tape,
+        TubeFloat = NumAlgorithms + Tube,
+        NumStates = NumAlgorithms * 2
+    };
+
+    //==============================================================================
+    template <typename SampleType>
+    SampleType processAlgorithm (int algo, SampleType input)
+    {
+        switch (algo)
         {
             case Clean:
                 // Simple gain - no saturation
-                return input * driveLinear;
+                return input * hot.driveLinear;
 
             case Pure:
                 // PurestDrive saturation
-                return purestDrive.process (input, driveDB);
+                return purestDrive.get()->process (input, hot.driveDB);
 
             case Tape:
                 // ToTape8 tape saturation
-                return toTape8.process (input, driveDB);
+                return toTape8.get()->process (input, hot.driveDB);
 
             case Tube:
                 // Tube2 tube saturation
-                return tube2.process (input, driveDB);
+                return tube2.get()->process (input, hot.driveDB);
 
             case HardClip:
                 // FinalClip hard clipper with drive compensation
                 {
-                    float driven = input * driveLinear;
-                    float processed = finalClip.process (driven);
-                    return processed / driveLinear; // Compensate drive
+                    SampleType driven = input * hot.driveLinear;
+                    SampleType processed = finalClip.get()->process (driven);
+                    return processed / hot.driveLinear; // Compensate drive
                 }
 
             case SoftClip:
                 // ClipSoftly soft clipper with drive compensation
                 {
-                    float driven = input * driveLinear;
-                    float processed = clipSoftly.process (driven);
-                    return processed / driveLinear; // Compensate drive
+                    SampleType driven = input * hot.driveLinear;
+                    SampleType processed = clipSoftly.get()->process (driven);
+                    return processed / hot.driveLinear; // Compensate drive
                 }
 
+            // Eco precision variants
+            case PureFloat: return purestDriveFloat.get()->process (input, hot.driveDB);
+            case TapeFloat: return toTape8Float.get()->process (input, hot.driveDB);
+            case TubeFloat: return tube2Float.get()->process (input, hot.driveDB);
+
             default:
                 return input;
         }
     }
 
-private:
+    void resetAlgorithm (int algo)
+    {
+        switch (algo)
+        {
+            case Pure: purestDrive.get()->reset(); break;
+            case Tape: toTape8.get()->reset(); break;
+            case Tube: tube2.get()->reset(); break;
+            case HardClip: finalClip.get()->reset(); break;
+            case SoftClip: clipSoftly.get()->reset(); break;
+            case PureFloat: purestDriveFloat.get()->reset(); break;
+            case TapeFloat: toTape8Float.get()->reset(); break;
+            case TubeFloat: tube2Float.get()->reset(); break;
+            default: break;
+        }
+    }
+
+    static int getStateIndex (Algorithm algo, bool useEcoPrecision)
+    {
+        if (useEcoPrecision && (algo == Pure || algo == Tape || algo == Tube))
+            return algo + NumAlgorithms;
+
+        return algo;
+    }
+
     //==============================================================================
-    Algorithm currentAlgorithm = Clean;  // Default: Clean
-    float driveDB = 0.0f;
-    float driveLinear = 1.0f;
+    struct HotState
+    {
+        float driveDB = 0.0f;
+        float driveLinear = 1.0f;
+    };
+
+    struct Config
+    {
+        Algorithm algorithm = Clean;  // Default: Clean
+        bool ecoPrecision = false;
+    };
 
-    // Algorithms (reused from Pre-Input)
-    PurestDrive purestDrive;
-    ToTape8 toTape8;
-    Tube2 tube2;
+    HotState hot;
+    AlgorithmStateSet<NumStates> algorithmStates;  // Active algorithm and crossfade
+    Config config;
+
+    // Algorithms (reused from Pre-Input, state allocated on demand - see AlgorithmStateSlot.h)
+    AlgorithmStateSlot<PurestDrive> purestDrive { [this] (PurestDrive& a) { a.setSampleRate (currentSampleRate); } };
+    AlgorithmStateSlot<ToTape8> toTape8 { [this] (ToTape8& a) { a.setSampleRate (currentSampleRate); },
+                                          ToTape8::getHeapBytes() };
+    AlgorithmStateSlot<Tube2> tube2 { [this] (Tube2& a) { a.setSampleRate (currentSampleRate); } };
 
     // Clippers (new)
-    FinalClip finalClip;
-    ClipSoftly clipSoftly;
+    AlgorithmStateSlot<FinalClip> finalClip { [this] (FinalClip& a) { a.setSampleRate (currentSampleRate); } };
+    AlgorithmStateSlot<ClipSoftly> clipSoftly { [this] (ClipSoftly& a) { a.setSampleRate (currentSampleRate); } };
+
+    // Eco precision variants
+    AlgorithmStateSlot<PurestDriveFloat> purestDriveFloat { [this] (PurestDriveFloat& a) { a.setSampleRate (currentSampleRate); } };
+    AlgorithmStateSlot<ToTape8Float> toTape8Float { [this] (ToTape8Float& a) { a.setSampleRate (currentSampleRate); },
+                                                    ToTape8Float::getHeapBytes() };
+    AlgorithmStateSlot<Tube2Float> tube2Float { [this] (Tube2Float& a) { a.setSampleRate (currentSampleRate); } };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OutStageSection)
 };
@@ -11,6 +11,8 @@
 #pragma once
 
 #include "BypassableSection.h"
+#include "AlgorithmStateSlot.h"
+#include "../ParameterSnapshot.h"
 #include "../Algorithms/PurestDrive.h"
 #include "../Algorithms/ToTape8.h"
 #include "../Algorithms/Tube2.h"
@@ -28,25 +30,80 @@ public:
         Clean = 0,
         Pure = 1,
         Tape = 2,
-        Tube = 3
+        Tube = 3,
+        NumAlgorithms
     };
 
-    PreInputSection() = default;
+    PreInputSection()
+    {
+        // Only the selected algorithm's state is allocated (Clean is stateless)
+        algorithmStates.setSlot (Pure, &purestDrive);
+        algorithmStates.setSlot (Tape, &toTape8);
+        algorithmStates.setSlot (Tube, &tube2);
+
+        algorithmStates.setSlot (PureFloat, &purestDriveFloat);
+        algorithmStates.setSlot (TapeFloat, &toTape8Float);
+        algorithmStates.setSlot (TubeFloat, &tube2Float);
+
+        // Airwindows ports: the per-block denormal offset (DenormalPolicy.h)
+        algorithmStates.setUsesDenormalOffset (true);
+    }
 
     //==============================================================================
     void setSampleRate (double sampleRate) override
     {
         BypassableSection::setSampleRate (sampleRate);
-        purestDrive.setSampleRate (sampleRate);
-        toTape8.setSampleRate (sampleRate);
-        tube2.setSampleRate (sampleRate);
+        purestDrive.prepareIfAllocated();
+        toTape8.prepareIfAllocated();
+        tube2.prepareIfAllocated();
+        purestDriveFloat.prepareIfAllocated();
+        toTape8Float.prepareIfAllocated();
+        tube2Float.prepareIfAllocated();
+        algorithmStates.setSampleRate (sampleRate);
     }
 
     void reset() override
     {
-        purestDrive.reset();
-        toTape8.reset();
-        tube2.reset();
+        // Only the active algorithm is owned by the audio thread
+        algorithmStates.reset ([this] (int algo) { resetAlgorithm (algo); });
+    }
+
+    //==============================================================================
+    /**
+        Allocates the state for the given algorithm and frees unused ones.
+        Call from the message thread (or prepareToPlay), never from the audio thread.
+    */
+    void updateAlgorithmStates (Algorithm algo, bool useEcoPrecision = false)
+    {
+        algorithmStates.updateAllocations (getStateIndex (algo, useEcoPrecision));
+    }
+
+    /**
+        Allocates the state of every algorithm in the given precision (offline
+        renders, where a switch must not wait for the message thread). Same
+        threading as updateAlgorithmStates(); the next updateAlgorithmStates()
+        frees them.
+    */
+    void allocateAllAlgorithmStates (bool useEcoPrecision)
+    {
+        AlgorithmStateSet<NumStates>::StateMask statesToKeep {};
+
+        for (int algo = 0; algo < NumAlgorithms; ++algo)
+            statesToKeep[static_cast<size_t> (getStateIndex (static_cast<Algorithm> (algo), useEcoPrecision))] = true;
+
+        algorithmStates.updateAllocations (statesToKeep);
+    }
+
+    /** Returns true (once) if updateAlgorithmStates() needs to run on the message thread. */
+    bool needsAlgorithmStateUpdate()
+    {
+        return algorithmStates.checkAndClearUpdateFlag();
+    }
+
+    /** Per-instance memory: section object plus allocated algorithm state. */
+    size_t getStateBytes() const
+    {
+        return sizeof (*this) + algorithmStates.getAllocatedBytes();
     }
 
     //==============================================================================
@@ -56,7 +113,20 @@ public:
     */
     void setAlgorithm (Algorithm algo)
     {
-        currentAlgorithm = algo;
+        config.algorithm = algo;
+        algorithmStates.select (getStateIndex (algo, config.ecoPrecision),
+                                [this] (int a, float x) { return processAlgorithm (a, x); },
+                                [this] (int a) { resetAlgorithm (a); });
+    }
+
+    /**
+        Runs the saturators in their float variants (see PurestDriveFloat etc.).
+        Takes effect on the next setAlgorithm() call, crossfaded like an
+        algorithm change.
+    */
+    void setEcoPrecision (bool shouldUseFloat)
+    {
+        config.ecoPrecision = shouldUseFloat;
     }
 
     /**
@@ -65,8 +135,8 @@ public:
     */
     void setDrive (float dB)
     {
-        driveDB = dB;
-        driveLinear = std::pow (10.0f, dB / 20.0f);
+        hot.driveDB = dB;
+        hot.driveLinear = std::pow (10.0f, dB / 20.0f);
     }
 
     /**
@@ -77,48 +147,141 @@ public:
     void setChannelIndex (int channelIdx)
     {
         // Use large prime offset (1000000007) to ensure completely different PRNG sequences
-        uint32_t seed = 17 + static_cast<uint32_t>(channelIdx) * 1000000007;
-        toTape8.setPRNGSeed (seed);
-        tube2.setPRNGSeed (seed);
+        config.prngSeed = 17 + static_cast<uint32_t>(channelIdx) * 1000000007;
     }
 
+    /**
+        Applies this section's fields of the block's parameter snapshot.
+        The algorithm is re-selected every block, so a selection deferred by a
+        running crossfade or a pending allocation is picked up; the drive and
+        bypass are only set when they changed.
+    */
+    void applyParameters (const ParameterSnapshot& params)
+    {
+        using P = ParameterSnapshot;
+
+        setEcoPrecision (params.getBool (P::EcoPrecision));
+        setAlgorithm (static_cast<Algorithm> (params.getChoice (P::PreInputAlgo)));
+
+        if (params.hasChanged (P::mask (P::PreInputDrive)))
+            setDrive (params[P::PreInputDrive]);
+        if (params.hasChanged (P::mask (P::PreInputBypass)))
+            setBypass (params.getBool (P::PreInputBypass));
+    }
+
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
+
 protected:
     //==============================================================================
     float processInternal (float input) override
     {
-        switch (currentAlgorithm)
+        // Runs the active algorithm (crossfaded from the outgoing one after a change).
+        // The active algorithm may briefly lag config.algorithm while the newly
+        // selected algorithm's state is being allocated.
+        return algorithmStates.process (input, [this] (int algo, auto x) { return processAlgorithm (algo, x); });
+    }
+
+    double processInternalDouble (double input) override
+    {
+        return algorithmStates.process (input, [this] (int algo, auto x) { return processAlgorithm (algo, x); });
+    }
+
+private:
+    // Float (eco precision) variants, registered after the regular algorithms
+    enum FloatVariant
+    {
+        PureFloat = NumAlgorithms + Pure,
+        TapeFloat = NumAlgorithms + Tape,
+        TubeFloat = NumAlgorithms + Tube,
+        NumStates = NumAlgorithms * 2
+    };
+
+    //==============================================================================
+    template <typename SampleType>
+    SampleType processAlgorithm (int algo, SampleType input)
+    {
+        switch (algo)
         {
             case Clean:
                 // Simple gain - no saturation
-                return input * driveLinear;
+                return input * hot.driveLinear;
 
             case Pure:
                 // PurestDrive saturation
-                return purestDrive.process (input, driveDB);
+                return purestDrive.get()->process (input, hot.driveDB);
 
             case Tape:
                 // ToTape8 tape saturation
-                return toTape8.process (input, driveDB);
+                return toTape8.get()->process (input, hot.driveDB);
 
             case Tube:
                 // Tube2 tube saturation
-                return tube2.process (input, driveDB);
+                return tube2.get()->process (input, hot.driveDB);
+
+            // Eco precision variants
+            case PureFloat: return purestDriveFloat.get()->process (input, hot.driveDB);
+            case TapeFloat: return toTape8Float.get()->process (input, hot.driveDB);
+            case TubeFloat: return tube2Float.get()->process (input, hot.driveDB);
 
             default:
                 return input;
         }
     }
 
-private:
+    void resetAlgorithm (int algo)
+    {
+        switch (algo)
+        {
+            case Pure: purestDrive.get()->reset(); break;
+            case Tape: toTape8.get()->reset(); break;
+            case Tube: tube2.get()->reset(); break;
+            case PureFloat: purestDriveFloat.get()->reset(); break;
+            case TapeFloat: toTape8Float.get()->reset(); break;
+            case TubeFloat: tube2Float.get()->reset(); break;
+            default: break;
+        }
+    }
+
+    /** State set index: the float variant of an algorithm sits NumAlgorithms further up. */
+    static int getStateIndex (Algorithm algo, bool useEcoPrecision)
+    {
+        if (useEcoPrecision && (algo == Pure || algo == Tape || algo == Tube))
+            return algo + NumAlgorithms;
+
+        return algo;
+    }
+
     //==============================================================================
-    Algorithm currentAlgorithm = Pure;  // Default: Pure
-    float driveDB = 0.0f;
-    float driveLinear = 1.0f;
-
-    // Algorithms
-    PurestDrive purestDrive;
-    ToTape8 toTape8;
-    Tube2 tube2;
+    struct HotState
+    {
+        float driveDB = 0.0f;
+        float driveLinear = 1.0f;
+    };
+
+    struct Config
+    {
+        Algorithm algorithm = Pure;  // Default: Pure
+        uint32_t prngSeed = 17;
+        bool ecoPrecision = false;
+    };
+
+    HotState hot;
+    AlgorithmStateSet<NumStates> algorithmStates;  // Active algorithm and crossfade
+    Config config;
+
+    // Algorithms (state allocated on demand, see AlgorithmStateSlot.h)
+    AlgorithmStateSlot<PurestDrive> purestDrive { [this] (PurestDrive& a) { a.setSampleRate (currentSampleRate); } };
+    AlgorithmStateSlot<ToTape8> toTape8 { [this] (ToTape8& a) { a.setPRNGSeed (config.prngSeed); a.setSampleRate (currentSampleRate); },
+                                          ToTape8::getHeapBytes() };
+    AlgorithmStateSlot<Tube2> tube2 { [this] (Tube2& a) { a.setPRNGSeed (config.prngSeed); a.setSampleRate (currentSampleRate); } };
+
+    AlgorithmStateSlot<PurestDriveFloat> purestDriveFloat { [this] (PurestDriveFloat& a) { a.setSampleRate (currentSampleRate); } };
+    AlgorithmStateSlot<ToTape8Float> toTape8Float { [this] (ToTape8Float& a) { a.setPRNGSeed (config.prngSeed); a.setSampleRate (currentSampleRate); },
+                                                    ToTape8Float::getHeapBytes() };
+    AlgorithmStateSlot<Tube2Float> tube2Float { [this] (Tube2Float& a) { a.setPRNGSeed (config.prngSeed); a.setSampleRate (currentSampleRate); } };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PreInputSection)
 };
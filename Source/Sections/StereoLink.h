@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    StereoLink.h
+    Shared detector input for stereo-linked dynamics sections
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    In linked mode one detector serves both channels: its input is derived
+    from L and R, and the resulting gain trajectory is applied to both, so
+    true-stereo material keeps its image and only one detector is computed.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace StereoLink
+{
+    enum Mode
+    {
+        Off = 0,    // Dual-mono: independent detectors
+        Max = 1,    // Detector follows the louder channel, max (|L|, |R|)
+        Sum = 2     // Detector follows the channel sum, normalised: (|L| + |R|) / 2
+    };
+
+    /** Processing chunk for the stack buffers of the linked paths. */
+    static constexpr int chunkSize = 64;
+
+    /** Fills levels[] with the linked detector input for numSamples samples. */
+    template <typename SampleType>
+    void computeLevels (SampleType* levels, const SampleType* left, const SampleType* right, int numSamples, Mode mode)
+    {
+        if (mode == Sum)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                levels[i] = SampleType (0.5) * (std::abs (left[i]) + std::abs (right[i]));
+        }
+        else
+        {
+            for (int i = 0; i < numSamples; ++i)
+                levels[i] = juce::jmax (std::abs (left[i]), std::abs (right[i]));
+        }
+    }
+
+    /**
+        As computeLevels(), but keeps the sign of the louder channel.
+        For detectors with an asymmetric transfer curve (CL1B sidechain table).
+    */
+    template <typename SampleType>
+    void computeSignedLevels (SampleType* levels, const SampleType* left, const SampleType* right, int numSamples, Mode mode)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const SampleType louder = (std::abs (left[i]) >= std::abs (right[i])) ? left[i] : right[i];
+
+            levels[i] = (mode == Sum) ? std::copysign (SampleType (0.5) * (std::abs (left[i]) + std::abs (right[i])), louder)
+                                      : louder;
+        }
+    }
+}
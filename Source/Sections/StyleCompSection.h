@@ -19,6 +19,9 @@
 #pragma once
 
 #include "BypassableSection.h"
+#include "AlgorithmStateSlot.h"
+#include "StereoLink.h"
+#include "../ParameterSnapshot.h"
 #include "../Algorithms/CL1BCompressor.h"
 #include "../Algorithms/DigitalVersatileCompressor.h"
 
@@ -34,33 +37,65 @@ public:
     enum Algorithm
     {
         Warm = 0,   // CL1B optical compressor (6:1)
-        Punch = 1   // Digital Versatile aggressive (7:1)
+        Punch = 1,  // Digital Versatile aggressive (7:1)
+        NumAlgorithms
     };
 
     StyleCompSection()
     {
-        compInGain = 1.0f;
-        makeupGain = 1.0f;
-        mixAmount = 1.0f;  // Default 100% wet
-
-        // Initialize both compressors with fixed threshold
-        warmCompressor.setParameters (-10.0f);  // Ratio 4:1 fixed internally
-        punchCompressor.setParameters (-10.0f, 20.0f, 24.0f, 10.0f);  // Ratio 20:1, Attack 24ms
+        // Only the selected compressor's state is allocated
+        // (fixed threshold is applied when the state is prepared, see members)
+        algorithmStates.setSlot (Warm, &warmCompressor);
+        algorithmStates.setSlot (Punch, &punchCompressor);
     }
 
     //==============================================================================
     void setSampleRate (double sampleRate) override
     {
         BypassableSection::setSampleRate (sampleRate);
-        warmCompressor.setSampleRate (sampleRate);
-        punchCompressor.setSampleRate (sampleRate);
-        updateCompression();
+        warmCompressor.prepareIfAllocated();
+        punchCompressor.prepareIfAllocated();
+        algorithmStates.setSampleRate (sampleRate);
     }
 
     void reset() override
     {
-        warmCompressor.reset();
-        punchCompressor.reset();
+        // Only the active compressor is owned by the audio thread
+        algorithmStates.reset ([this] (int algo) { resetAlgorithm (algo); });
+    }
+
+    //==============================================================================
+    /**
+        Allocates the state for the given compressor and frees the other one.
+        Call from the message thread (or prepareToPlay), never from the audio thread.
+    */
+    void updateAlgorithmStates (Algorithm algo)
+    {
+        algorithmStates.updateAllocations (algo);
+    }
+
+    /**
+        Allocates the state of every algorithm (offline renders, where a
+        switch must not wait for the message thread). Same threading as
+        updateAlgorithmStates(); the next updateAlgorithmStates() frees them.
+    */
+    void allocateAllAlgorithmStates()
+    {
+        AlgorithmStateSet<NumAlgorithms>::StateMask statesToKeep;
+        statesToKeep.fill (true);
+        algorithmStates.updateAllocations (statesToKeep);
+    }
+
+    /** Returns true (once) if updateAlgorithmStates() needs to run on the message thread. */
+    bool needsAlgorithmStateUpdate()
+    {
+        return algorithmStates.checkAndClearUpdateFlag();
+    }
+
+    /** Per-instance memory: section object plus allocated compressor state. */
+    size_t getStateBytes() const
+    {
+        return sizeof (*this) + algorithmStates.getAllocatedBytes();
     }
 
     //==============================================================================
@@ -70,8 +105,10 @@ public:
     */
     void setAlgorithm (Algorithm algo)
     {
-        currentAlgorithm = algo;
-        updateCompression();
+        config.algorithm = algo;
+        algorithmStates.select (algo,
+                                [this] (int a, float x) { return processAlgorithm (a, x); },
+                                [this] (int a) { resetAlgorithm (a); });
     }
 
     /**
@@ -81,8 +118,8 @@ public:
     */
     void setCompIn (float dB)
     {
-        compInDB = juce::jlimit (-18.0f, 60.0f, dB);
-        compInGain = std::pow (10.0f, compInDB / 20.0f);
+        config.compInDB = juce::jlimit (-18.0f, 60.0f, dB);
+        hot.compInGain = std::pow (10.0f, config.compInDB / 20.0f);
     }
 
     /**
@@ -92,8 +129,8 @@ public:
     */
     void setMakeup (float dB)
     {
-        makeupDB = juce::jlimit (-6.0f, 24.0f, dB);
-        makeupGain = std::pow (10.0f, makeupDB / 20.0f);
+        config.makeupDB = juce::jlimit (-6.0f, 24.0f, dB);
+        hot.makeupGain = std::pow (10.0f, config.makeupDB / 20.0f);
     }
 
     /**
@@ -102,8 +139,33 @@ public:
     */
     void setMix (float percent)
     {
-        mixPercent = juce::jlimit (0.0f, 100.0f, percent);
-        mixAmount = mixPercent / 100.0f;
+        config.mixPercent = juce::jlimit (0.0f, 100.0f, percent);
+        hot.mixAmount = config.mixPercent / 100.0f;
+    }
+
+    /**
+        Applies the Style-Comp fields of the block's parameter snapshot.
+        The algorithm is re-selected every block, the gain staging only when
+        it changed.
+    */
+    void applyParameters (const ParameterSnapshot& params)
+    {
+        using P = ParameterSnapshot;
+
+        setAlgorithm (params.getBool (P::StyleCompAlgo) ? Punch : Warm);
+
+        if (params.hasChanged (P::mask (P::StyleCompIn)))
+            setCompIn (params[P::StyleCompIn]);
+        if (params.hasChanged (P::mask (P::StyleCompMakeup)))
+            setMakeup (params[P::StyleCompMakeup]);
+        if (params.hasChanged (P::mask (P::StyleCompMix)))
+            setMix (params[P::StyleCompMix]);
+        if (params.hasChanged (P::mask (P::StyleCompBypass)))
+            setBypass (params.getBool (P::StyleCompBypass));
+
+        // Keep the envelope moving while bypassed so re-engaging doesn't pump
+        if (params.hasChanged (P::mask (P::DetectorsWhileBypassed)))
+            setDetectorsRunWhileBypassed (params.getBool (P::DetectorsWhileBypassed));
     }
 
     /**
@@ -112,77 +174,278 @@ public:
     */
     float getGainReductionDB() const
     {
-        if (currentAlgorithm == Warm)
-            return warmCompressor.getGainReductionDB();
-        else
-            return punchCompressor.getGainReductionDB();
+        switch (algorithmStates.getActive())
+        {
+            case Warm: return warmCompressor.get()->getGainReductionDB();
+            case Punch: return punchCompressor.get()->getGainReductionDB();
+            default: return 0.0f;
+        }
     }
 
-protected:
     //==============================================================================
-    float processInternal (float input) override
+    /** True if both sections can run the stereo-linked path this block. */
+    static bool canProcessLinked (const StyleCompSection& left, const StyleCompSection& right)
     {
-        // Store dry signal for mixing
-        float dry = input;
+        const int algo = left.algorithmStates.getActive();
 
-        // Apply Comp IN gain (increase level before compression)
-        float driven = input * compInGain;
+        return left.isFullyActive() && right.isFullyActive()
+            && algo != AlgorithmStateSet<NumAlgorithms>::noAlgorithm
+            && algo == right.algorithmStates.getActive()
+            && ! left.algorithmStates.isTransitioning()
+            && ! right.algorithmStates.isTransitioning();
+    }
 
-        // Process through selected compressor
-        float compressed;
+    /**
+        Stereo-linked processing: the left section's compressor detector runs on
+        the linked (Comp IN driven) level and its gain trajectory is applied to
+        both channels. Comp IN, makeup and mix stay per channel; the right
+        detector is kept in sync so unlinking is seamless (and meters match).
+    */
+    template <typename SampleType>
+    static void processStereoLinked (StyleCompSection& left, StyleCompSection& right,
+                                     SampleType* leftData, SampleType* rightData, int numSamples,
+                                     StereoLink::Mode mode)
+    {
+        const bool isWarm = left.algorithmStates.getActive() == Warm;
+
+        // Dry copies in each section's scratch, the shared gains in the left
+        // one's (stack chunks for sections used without scratch)
+        SampleType stackDryLeft[StereoLink::chunkSize];
+        SampleType stackDryRight[StereoLink::chunkSize];
+        SampleType stackGains[StereoLink::chunkSize];
 
-        if (currentAlgorithm == Warm)
+        SampleType* dryLeft = left.getSectionScratch<SampleType> (dryBlock);
+        SampleType* dryRight = right.getSectionScratch<SampleType> (dryBlock);
+        SampleType* gains = left.getSectionScratch<SampleType> (gainBlock);
+        int maxChunk = juce::jmin (left.getScratchSamples(), right.getScratchSamples());
+
+        if (dryLeft == nullptr || dryRight == nullptr)
         {
-            compressed = warmCompressor.process (driven);
+            dryLeft = stackDryLeft;
+            dryRight = stackDryRight;
+            gains = stackGains;
+            maxChunk = StereoLink::chunkSize;
         }
-        else // Punch
+
+        for (int offset = 0; offset < numSamples; offset += maxChunk)
         {
-            compressed = punchCompressor.process (driven);
+            const int num = juce::jmin (maxChunk, numSamples - offset);
+            SampleType* l = leftData + offset;
+            SampleType* r = rightData + offset;
+
+            juce::FloatVectorOperations::copy (dryLeft, l, num);
+            juce::FloatVectorOperations::copy (dryRight, r, num);
+            left.algorithmStates.recordInput (dryLeft, num);
+            right.algorithmStates.recordInput (dryRight, num);
+
+            // Comp IN gain (per channel)
+            juce::FloatVectorOperations::multiply (l, static_cast<SampleType> (left.hot.compInGain), num);
+            juce::FloatVectorOperations::multiply (r, static_cast<SampleType> (right.hot.compInGain), num);
+
+            // Shared detector
+            if (isWarm)
+            {
+                StereoLink::computeSignedLevels (gains, l, r, num, mode);
+
+                auto* comp = left.warmCompressor.get();
+                for (int i = 0; i < num; ++i)
+                    gains[i] = comp->updateLinkedGain (static_cast<float> (gains[i]));
+            }
+            else
+            {
+                StereoLink::computeLevels (gains, l, r, num, mode);
+
+                auto* comp = left.punchCompressor.get();
+                for (int i = 0; i < num; ++i)
+                    gains[i] = comp->updateGain (static_cast<float> (gains[i]));
+            }
+
+            juce::FloatVectorOperations::multiply (l, gains, num);
+            juce::FloatVectorOperations::multiply (r, gains, num);
+
+            if (isWarm)
+            {
+                // Post-EQ keeps per-channel state
+                auto* leftComp = left.warmCompressor.get();
+                auto* rightComp = right.warmCompressor.get();
+                for (int i = 0; i < num; ++i)
+                {
+                    l[i] = leftComp->processPostEQ (static_cast<float> (l[i]));
+                    r[i] = rightComp->processPostEQ (static_cast<float> (r[i]));
+                }
+            }
+
+            left.applyMakeupAndMix (l, dryLeft, num);
+            right.applyMakeupAndMix (r, dryRight, num);
         }
 
-        // Compensate Comp IN gain (decrease level after compression)
-        compressed = compressed / compInGain;
+        if (isWarm)
+            right.warmCompressor.get()->copyDetectorStateFrom (*left.warmCompressor.get());
+        else
+            right.punchCompressor.get()->copyStateFrom (*left.punchCompressor.get());
+    }
 
-        // Apply manual makeup gain
-        float wet = compressed * makeupGain;
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
 
+protected:
+    //==============================================================================
+    float processInternal (float input) override
+    {
         // Mix dry and wet
-        return dry * (1.0f - mixAmount) + wet * mixAmount;
+        return input * (1.0f - hot.mixAmount) + processWet (input) * hot.mixAmount;
+    }
+
+    void processInternalBlock (float* data, int numSamples) override
+    {
+        processMixedBlock (data, numSamples);
+    }
+
+    void processInternalBlockDouble (double* data, int numSamples) override
+    {
+        processMixedBlock (data, numSamples);
+    }
+
+    int getNumSectionScratchBlocks() const override
+    {
+        return 2;  // Dry copy, linked detector gains
+    }
+
+    void updateDetectorsWhileBypassed (const float* input, int numSamples) override
+    {
+        // Detector sees the Comp IN driven signal, as in processAlgorithm()
+        switch (algorithmStates.getActive())
+        {
+            case Warm:
+                warmCompressor.get()->advanceDetector (getBlockPeak (input, numSamples) * hot.compInGain, numSamples);
+                break;
+
+            case Punch:
+                punchCompressor.get()->advanceDetector (getBlockMeanAbsolute (input, numSamples) * hot.compInGain, numSamples);
+                break;
+
+            default:
+                break;
+        }
     }
 
 private:
     //==============================================================================
-    void updateCompression()
+    static constexpr int dryBlock = 0;      // Section scratch blocks
+    static constexpr int gainBlock = 1;
+
+    float processWet (float input)
+    {
+        // Runs the active compressor (crossfaded from the outgoing one after a change).
+        // The active compressor may briefly lag config.algorithm while the newly
+        // selected compressor's state is being allocated.
+        float compressed = algorithmStates.process (input, [this] (int algo, float x) { return processAlgorithm (algo, x); });
+
+        // Apply manual makeup gain
+        return compressed * hot.makeupGain;
+    }
+
+    /** Dual-mono block path: dry copy in scratch, vector mix (the compressor runs per sample). */
+    template <typename SampleType>
+    void processMixedBlock (SampleType* data, int numSamples)
     {
-        // Fixed threshold at -10dB for both compressors
-        if (currentAlgorithm == Warm)
+        auto processWetChunk = [this] (SampleType* chunk, int num)
         {
-            warmCompressor.setParameters (-10.0f);  // Ratio 4:1 fixed internally
+            for (int i = 0; i < num; ++i)
+                chunk[i] = static_cast<SampleType> (processWet (static_cast<float> (chunk[i])));
+        };
+
+        // Fully wet: no dry copy needed
+        if (hot.mixAmount >= 1.0f)
+            processWetChunk (data, numSamples);
+        else
+            processWithDryMix (data, numSamples, hot.mixAmount, processWetChunk);
+    }
+
+    /** Comp IN compensation, makeup and dry/wet mix for a block (linked path). */
+    template <typename SampleType>
+    void applyMakeupAndMix (SampleType* data, const SampleType* dry, int numSamples) const
+    {
+        juce::FloatVectorOperations::multiply (data, static_cast<SampleType> (hot.makeupGain / hot.compInGain * hot.mixAmount), numSamples);
+        juce::FloatVectorOperations::addWithMultiply (data, dry, static_cast<SampleType> (1.0f - hot.mixAmount), numSamples);
+    }
+
+    float processAlgorithm (int algo, float input)
+    {
+        // Apply Comp IN gain (increase level before compression)
+        float driven = input * hot.compInGain;
+
+        // Process through selected compressor
+        float compressed;
+
+        switch (algo)
+        {
+            case Warm:
+                compressed = warmCompressor.get()->process (driven);
+                break;
+
+            case Punch:
+                compressed = punchCompressor.get()->process (driven);
+                break;
+
+            default: // Not allocated yet
+                return input;
         }
-        else // Punch
+
+        // Compensate Comp IN gain (decrease level after compression)
+        return compressed / hot.compInGain;
+    }
+
+    void resetAlgorithm (int algo)
+    {
+        switch (algo)
         {
-            // Ratio 20:1, Attack 24ms, Release 10ms (very aggressive limiter-like)
-            punchCompressor.setParameters (-10.0f, 20.0f, 24.0f, 10.0f);
+            case Warm: warmCompressor.get()->reset(); break;
+            case Punch: punchCompressor.get()->reset(); break;
+            default: break;
         }
     }
 
     //==============================================================================
-    CL1BCompressor warmCompressor;
-    DigitalVersatileCompressor punchCompressor;
+    // Fixed threshold at -10dB for both compressors
+    void prepareWarm (CL1BCompressor& comp)
+    {
+        comp.setSampleRate (currentSampleRate);
+        comp.setParameters (-10.0f);  // Ratio 4:1 fixed internally
+    }
 
-    Algorithm currentAlgorithm = Warm;  // Default: Warm
+    void preparePunch (DigitalVersatileCompressor& comp)
+    {
+        comp.setSampleRate (currentSampleRate);
+        // Ratio 20:1, Attack 24ms, Release 10ms (very aggressive limiter-like)
+        comp.setParameters (-10.0f, 20.0f, 24.0f, 10.0f);
+    }
 
-    // Comp IN (drive) parameters
-    float compInDB = 0.0f;      // Default: 0dB (no drive)
-    float compInGain = 1.0f;
+    //==============================================================================
+    struct HotState
+    {
+        float compInGain = 1.0f;
+        float makeupGain = 1.0f;
+        float mixAmount = 1.0f;     // Default 100% wet
+    };
+
+    struct Config
+    {
+        Algorithm algorithm = Warm;  // Default: Warm
+        float compInDB = 0.0f;      // Default: 0dB (no drive)
+        float makeupDB = 0.0f;      // Default: 0dB (no makeup)
+        float mixPercent = 100.0f;  // Default: 100% (full wet)
+    };
 
-    // Makeup gain parameters
-    float makeupDB = 0.0f;      // Default: 0dB (no makeup)
-    float makeupGain = 1.0f;
+    HotState hot;
+    AlgorithmStateSet<NumAlgorithms> algorithmStates;  // Active compressor and crossfade
+    Config config;
 
-    // Mix parameters
-    float mixPercent = 100.0f;  // Default: 100% (full wet)
-    float mixAmount = 1.0f;
+    // Compressors (state allocated on demand, see AlgorithmStateSlot.h)
+    AlgorithmStateSlot<CL1BCompressor> warmCompressor { [this] (CL1BCompressor& c) { prepareWarm (c); } };
+    AlgorithmStateSlot<DigitalVersatileCompressor> punchCompressor { [this] (DigitalVersatileCompressor& c) { preparePunch (c); } };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StyleCompSection)
 };
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "BypassableSection.h"
+#include "../ParameterSnapshot.h"
 
 //==============================================================================
 /**
@@ -28,21 +29,62 @@ public:
     */
     void setGain (float dB)
     {
-        gainDB = dB;
-        gainLinear = std::pow (10.0f, dB / 20.0f);
+        config.gainDB = dB;
+        hot.gainLinear = std::pow (10.0f, dB / 20.0f);
     }
 
+    /** Applies the output gain (plus its channel variation offset) and bypass from the block's snapshot. */
+    void applyParameters (const ParameterSnapshot& params, const ChannelVariationPreset& variation)
+    {
+        using P = ParameterSnapshot;
+
+        if (params.hasChanged (P::mask (P::OutputGain) | P::channelVariationFields))
+            setGain (params[P::OutputGain] + variation.outputGain);
+        if (params.hasChanged (P::mask (P::VolumeBypass)))
+            setBypass (params.getBool (P::VolumeBypass));
+    }
+
+    //==============================================================================
+    /** Per-lane layout (see BypassableSection): bytes of the hot state and of the config. */
+    static constexpr size_t getHotStateBytes() noexcept   { return sizeof (HotState); }
+    static constexpr size_t getConfigBytes() noexcept     { return sizeof (Config); }
+
 protected:
     //==============================================================================
     float processInternal (float input) override
     {
-        return input * gainLinear;
+        return input * hot.gainLinear;
+    }
+
+    void processInternalBlock (float* data, int numSamples) override
+    {
+        juce::FloatVectorOperations::multiply (data, hot.gainLinear, numSamples);
+    }
+
+    double processInternalDouble (double input) override
+    {
+        return input * hot.gainLinear;
+    }
+
+    void processInternalBlockDouble (double* data, int numSamples) override
+    {
+        juce::FloatVectorOperations::multiply (data, static_cast<double> (hot.gainLinear), numSamples);
     }
 
 private:
     //==============================================================================
-    float gainDB = 0.0f;
-    float gainLinear = 1.0f;
+    struct HotState
+    {
+        float gainLinear = 1.0f;
+    };
+
+    struct Config
+    {
+        float gainDB = 0.0f;
+    };
+
+    HotState hot;
+    Config config;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VolumeSection)
 };
@@ -0,0 +1,174 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.cpp
+    Pre/post spectrum of the channel strip, analysed off the audio thread
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyser.h"
+
+//==============================================================================
+class SpectrumAnalyser::AnalysisThread : public juce::Thread
+{
+public:
+    explicit AnalysisThread (SpectrumAnalyser& owner)
+        : juce::Thread ("AnalogChannel analyser"), analyser (owner)
+    {
+    }
+
+    void run() override
+    {
+        analyser.discardStaleData();
+
+        while (! threadShouldExit())
+        {
+            analyser.analyse();
+            wait (1000 / frameRateHz);
+        }
+    }
+
+private:
+    SpectrumAnalyser& analyser;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AnalysisThread)
+};
+
+//==============================================================================
+SpectrumAnalyser::SpectrumAnalyser()
+{
+    for (int tap = 0; tap < NumTaps; ++tap)
+    {
+        smoothed[tap].fill (minDecibels);
+        published[tap].fill (minDecibels);
+    }
+}
+
+SpectrumAnalyser::~SpectrumAnalyser()
+{
+    setActive (false);
+}
+
+void SpectrumAnalyser::setActive (bool shouldBeActive)
+{
+    if (shouldBeActive == (thread != nullptr))
+        return;
+
+    if (shouldBeActive)
+    {
+        // First activation allocates; the buffers are kept afterwards, so the
+        // audio thread never sees them change
+        if (fft == nullptr)
+        {
+            for (int tap = 0; tap < NumTaps; ++tap)
+            {
+                fifoBuffers[tap].calloc (static_cast<size_t> (fifoSize));
+                history[tap].calloc (static_cast<size_t> (fftSize));
+            }
+
+            fftData.calloc (static_cast<size_t> (2 * fftSize));
+            fft = std::make_unique<juce::dsp::FFT> (fftOrder);
+            window = std::make_unique<juce::dsp::WindowingFunction<float>> (static_cast<size_t> (fftSize),
+                                                                            juce::dsp::WindowingFunction<float>::hann,
+                                                                            false);
+        }
+
+        active.store (true, std::memory_order_release);
+        thread = std::make_unique<AnalysisThread> (*this);
+        thread->startThread();
+    }
+    else
+    {
+        active.store (false, std::memory_order_release);
+        thread->stopThread (1000);
+        thread.reset();
+    }
+}
+
+bool SpectrumAnalyser::copyFrame (Tap tap, Frame& destination, uint32_t& lastFrameSeen) const
+{
+    const juce::SpinLock::ScopedLockType lock (frameLock);
+
+    if (frameCounter == lastFrameSeen)
+        return false;
+
+    destination = published[tap];
+    lastFrameSeen = frameCounter;
+    return true;
+}
+
+//==============================================================================
+void SpectrumAnalyser::discardStaleData()
+{
+    // Whatever is still queued from a previous activation is stale. Drained
+    // here, on the FIFOs' reader, not by the message thread in setActive()
+    for (auto& fifo : fifos)
+        fifo.finishedRead (fifo.getNumReady());
+
+    for (auto& frame : smoothed)
+        frame.fill (minDecibels);
+}
+
+void SpectrumAnalyser::analyse()
+{
+    // Amplitude of a full-scale sine at 0dB: Hann coherent gain 0.5, one-sided
+    const float magnitudeScale = 4.0f / static_cast<float> (fftSize);
+    bool hasNewData = false;
+
+    for (int tap = 0; tap < NumTaps; ++tap)
+    {
+        auto& fifo = fifos[tap];
+        const int numReady = fifo.getNumReady();
+
+        if (numReady == 0)
+            continue;
+
+        // Only the newest fftSize samples matter
+        int start1, size1, start2, size2;
+        fifo.prepareToRead (numReady, start1, size1, start2, size2);
+
+        auto appendToHistory = [&] (const float* source, int num)
+        {
+            for (int i = juce::jmax (0, num - fftSize); i < num; ++i)
+            {
+                history[tap][historyPosition[tap]] = source[i];
+                historyPosition[tap] = (historyPosition[tap] + 1) & (fftSize - 1);
+            }
+        };
+
+        appendToHistory (fifoBuffers[tap].get() + start1, size1);
+        appendToHistory (fifoBuffers[tap].get() + start2, size2);
+        fifo.finishedRead (size1 + size2);
+
+        // Oldest sample first, windowed, then magnitudes in place
+        for (int i = 0; i < fftSize; ++i)
+            fftData[i] = history[tap][(historyPosition[tap] + i) & (fftSize - 1)];
+
+        window->multiplyWithWindowingTable (fftData.get(), static_cast<size_t> (fftSize));
+        fft->performFrequencyOnlyForwardTransform (fftData.get(), true);
+
+        // Instant rise, smooth fall (about 20dB per second at 30 frames)
+        for (int bin = 0; bin < numBins; ++bin)
+        {
+            const float level = juce::Decibels::gainToDecibels (fftData[bin] * magnitudeScale, minDecibels);
+            auto& value = smoothed[tap][static_cast<size_t> (bin)];
+            value = level > value ? level : juce::jmax (level, value - 0.7f);
+        }
+
+        hasNewData = true;
+    }
+
+    if (! hasNewData)
+        return;
+
+    const juce::SpinLock::ScopedLockType lock (frameLock);
+
+    for (int tap = 0; tap < NumTaps; ++tap)
+        published[tap] = smoothed[tap];
+
+    ++frameCounter;
+}
@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.h
+    Pre/post spectrum of the channel strip, analysed off the audio thread
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    The audio thread mixes each block to mono and pushes it into a lock-free
+    FIFO per tap (chain input and output). A background thread drains the
+    FIFOs, runs one Hann-windowed FFT per tap at most frameRateHz times per
+    second and publishes smoothed magnitude frames (dB) for the editor.
+
+    Everything only runs while an editor shows the analyser (setActive()):
+    otherwise push() is one atomic load, no thread runs and the FIFO
+    memory isn't even allocated (it is on first activation, and kept).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+//==============================================================================
+class SpectrumAnalyser
+{
+public:
+    enum Tap
+    {
+        Input,   // Before the chain
+        Output,  // After the chain (what the host receives)
+        NumTaps
+    };
+
+    static constexpr int fftOrder = 11;
+    static constexpr int fftSize = 1 << fftOrder;       // 2048: 23Hz bins at 48kHz
+    static constexpr int numBins = fftSize / 2;
+    static constexpr int frameRateHz = 30;
+    static constexpr int fifoSize = 1 << 15;            // > one frame period at 384kHz
+    static constexpr float minDecibels = -100.0f;
+
+    using Frame = std::array<float, numBins>;
+
+    SpectrumAnalyser();
+    ~SpectrumAnalyser();
+
+    //==============================================================================
+    /** Starts or stops the analysis (message thread; the editor's analyser view). */
+    void setActive (bool shouldBeActive);
+    bool isActive() const { return active.load (std::memory_order_relaxed); }
+
+    /** Sample rate of the pushed audio (prepareToPlay), for the bin frequencies. */
+    void setSampleRate (double newSampleRate) { sampleRate.store (newSampleRate); }
+    double getSampleRate() const { return sampleRate.load(); }
+
+    //==============================================================================
+    /**
+        Audio thread: pushes the first numChannels channels, mixed to mono.
+        Samples that don't fit (the analysis thread fell behind) are dropped.
+    */
+    template <typename SampleType>
+    void push (Tap tap, const juce::AudioBuffer<SampleType>& buffer, int numChannels)
+    {
+        if (! active.load (std::memory_order_acquire) || numChannels <= 0)
+            return;
+
+        auto& fifo = fifos[tap];
+        const int numSamples = juce::jmin (buffer.getNumSamples(), fifo.getFreeSpace());
+        const float channelGain = 1.0f / static_cast<float> (numChannels);
+
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite (numSamples, start1, size1, start2, size2);
+
+        auto mixDown = [&] (float* destination, int offset, int num)
+        {
+            for (int i = 0; i < num; ++i)
+            {
+                float sum = 0.0f;
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                    sum += static_cast<float> (buffer.getReadPointer (ch)[offset + i]);
+
+                destination[i] = sum * channelGain;
+            }
+        };
+
+        mixDown (fifoBuffers[tap].get() + start1, 0, size1);
+        mixDown (fifoBuffers[tap].get() + start2, size1, size2);
+        fifo.finishedWrite (size1 + size2);
+    }
+
+    //==============================================================================
+    /**
+        GUI: copies the latest frame of a tap (dB per bin). Returns false if
+        nothing was published since the frame counter last seen.
+    */
+    bool copyFrame (Tap tap, Frame& destination, uint32_t& lastFrameSeen) const;
+
+private:
+    //==============================================================================
+    class AnalysisThread;
+
+    // Analysis thread
+    void discardStaleData();  // Once per activation, before the first analyse()
+    void analyse();
+
+    std::atomic<bool> active { false };
+    std::atomic<double> sampleRate { 44100.0 };
+
+    // Audio thread -> analysis thread
+    juce::AbstractFifo fifos[NumTaps] { juce::AbstractFifo (fifoSize), juce::AbstractFifo (fifoSize) };
+    juce::HeapBlock<float> fifoBuffers[NumTaps];
+
+    // Analysis thread only
+    juce::HeapBlock<float> history[NumTaps];             // Last fftSize samples, circular
+    int historyPosition[NumTaps] {};
+    juce::HeapBlock<float> fftData;
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::unique_ptr<juce::dsp::WindowingFunction<float>> window;
+    Frame smoothed[NumTaps];
+
+    // Analysis thread -> GUI
+    mutable juce::SpinLock frameLock;
+    Frame published[NumTaps];
+    uint32_t frameCounter = 0;
+
+    std::unique_ptr<AnalysisThread> thread;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyser)
+};
@@ -0,0 +1,206 @@
+/*
+  ==============================================================================
+
+    WorkerPool.cpp
+    Worker threads that share one processBlock's independent channel groups
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "WorkerPool.h"
+#include <thread>
+
+//==============================================================================
+class WorkerPool::Worker : public juce::Thread
+{
+public:
+    Worker (WorkerPool& owner, int index)
+        : juce::Thread ("AnalogChannel worker " + juce::String (index + 1)),
+          pool (owner)
+    {
+    }
+
+    void run() override
+    {
+        // FTZ/DAZ are per-thread flags: tasks must see the same arithmetic as
+        // on the audio thread
+        juce::ScopedNoDenormals noDenormals;
+
+        uint32_t seenGeneration = static_cast<uint32_t> (pool.jobState.load() >> 32);
+
+        while (pool.waitForJob (seenGeneration, *this))
+            while (pool.runNextTask (seenGeneration)) {}
+    }
+
+    juce::WaitableEvent wakeUp;
+
+private:
+    WorkerPool& pool;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Worker)
+};
+
+//==============================================================================
+WorkerPool::WorkerPool() = default;
+
+WorkerPool::~WorkerPool()
+{
+    release();
+}
+
+void WorkerPool::prepare (int numWorkers, double blockPeriodMs)
+{
+    release();
+
+    const double ticksPerMs = 0.001 * static_cast<double> (juce::Time::getHighResolutionTicksPerSecond());
+    spinTicks = static_cast<juce::int64> (spinFraction * blockPeriodMs * ticksPerMs);
+    waitTicks = static_cast<juce::int64> (0.5 * blockPeriodMs * ticksPerMs);
+    inlineJobsRemaining = 0;
+
+    for (int i = 0; i < numWorkers; ++i)
+    {
+        auto* worker = workers.add (new Worker (*this, i));
+
+        // Realtime (time-constraint) scheduling, so a worker running a task the
+        // audio thread waits for isn't preempted by ordinary threads
+        if (! worker->startRealtimeThread (juce::Thread::RealtimeOptions{}.withPeriodMs (blockPeriodMs)))
+            worker->startThread (juce::Thread::Priority::highest);
+    }
+}
+
+void WorkerPool::release()
+{
+    for (auto* worker : workers)
+    {
+        worker->signalThreadShouldExit();
+        worker->wakeUp.signal();
+    }
+
+    for (auto* worker : workers)
+        worker->stopThread (1000);
+
+    workers.clear();
+    numSleeping.store (0);
+}
+
+int WorkerPool::getRecommendedNumWorkers (int numTaskGroups)
+{
+    // The calling thread runs one group itself
+    return juce::jlimit (0, juce::jmax (0, numTaskGroups - 1), juce::SystemStats::getNumPhysicalCpus() - 1);
+}
+
+//==============================================================================
+void WorkerPool::runJob (int numTasks, void* context, TaskFunction function)
+{
+    jassert (numTasks <= maxTasks);
+
+    // Written before the job state is published (a worker reads them only
+    // after claiming a task of this generation)
+    jobContext.store (context, std::memory_order_relaxed);
+    jobFunction.store (function, std::memory_order_relaxed);
+    tasksDone.store (0, std::memory_order_relaxed);
+
+    ++generation;
+    jobState.store (makeJobState (generation, numTasks));
+
+    // Only sleeping workers need the (event) wake-up; spinning ones see the
+    // new generation directly
+    if (numSleeping.load() > 0)
+        for (auto* worker : workers)
+            worker->wakeUp.signal();
+
+    // The caller works too, and takes every task no worker has claimed yet
+    while (runNextTask (generation)) {}
+
+    // Tasks a worker has already started: spin up to the bound, then yield.
+    // A stall means a worker lost its core, so the next jobs stay inline.
+    const auto waitDeadline = juce::Time::getHighResolutionTicks() + waitTicks;
+    bool isStalled = false;
+
+    for (int spins = 0; tasksDone.load (std::memory_order_acquire) < numTasks; ++spins)
+    {
+        if ((spins & 255) != 255)
+            continue;
+
+        if (! isStalled && juce::Time::getHighResolutionTicks() > waitDeadline)
+        {
+            isStalled = true;
+            inlineJobsRemaining = inlineJobsAfterStall;
+        }
+
+        if (isStalled)
+            std::this_thread::yield();
+    }
+}
+
+bool WorkerPool::runNextTask (uint32_t jobGeneration)
+{
+    uint64_t state = jobState.load (std::memory_order_acquire);
+
+    for (;;)
+    {
+        if (static_cast<uint32_t> (state >> 32) != jobGeneration)
+            return false;  // Woke up for a job that is already over
+
+        const int numTasks = static_cast<int> ((state >> 16) & 0xffffu);
+        const int index = static_cast<int> (state & 0xffffu);
+
+        if (index >= numTasks)
+            return false;
+
+        if (jobState.compare_exchange_weak (state, state + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            jobFunction.load (std::memory_order_relaxed) (jobContext.load (std::memory_order_relaxed), index);
+            tasksDone.fetch_add (1, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+bool WorkerPool::waitForJob (uint32_t& seenGeneration, Worker& worker)
+{
+    auto hasNewJob = [&]
+    {
+        // seq_cst: pairs with the caller's store / numSleeping load
+        const auto jobGeneration = static_cast<uint32_t> (jobState.load() >> 32);
+
+        if (jobGeneration == seenGeneration)
+            return false;
+
+        seenGeneration = jobGeneration;
+        return true;
+    };
+
+    // Busy-wait for the spin time (the next block usually arrives within it)
+    const auto spinDeadline = juce::Time::getHighResolutionTicks() + spinTicks;
+
+    for (int spins = 0; ! worker.threadShouldExit(); ++spins)
+    {
+        if (hasNewJob())
+            return true;
+
+        if ((spins & 63) == 63 && juce::Time::getHighResolutionTicks() > spinDeadline)
+            break;
+    }
+
+    // Then sleep until the caller signals. The count is raised before the
+    // final check, so a job published in between is never missed.
+    numSleeping.fetch_add (1);
+
+    while (! worker.threadShouldExit())
+    {
+        if (hasNewJob())
+        {
+            numSleeping.fetch_sub (1);
+            return true;
+        }
+
+        worker.wakeUp.wait (100);
+    }
+
+    numSleeping.fetch_sub (1);
+    return false;
+}
@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+
+    WorkerPool.h
+    Worker threads that share one processBlock's independent channel groups
+
+    Copyright (c) 2025 KuramaSound
+    Licensed under GPL v3 - see LICENSE file for details
+
+    run (numTasks, task) calls task (i) for every i, spread over the pool's
+    workers and the calling (audio) thread, and returns when all are done.
+    Tasks are claimed from a shared counter, so the caller takes whatever
+    the workers haven't picked up: when the host keeps every core busy and
+    a worker doesn't get scheduled in time, the block simply runs on the
+    calling thread as before. Only a task a worker has already started is
+    waited for.
+
+    Handoff: after a job a worker spins (busy-wait) for most of a block
+    period - never a whole one, so a worker doesn't keep its core busy
+    between blocks - and picks the next block up without a wake-up when it
+    arrives within that time; otherwise it sleeps on an event until the
+    caller signals it. Workers are realtime threads with the block period as
+    their period (a worker preempted mid-task stalls the audio thread), and
+    run with flush-to-zero like the audio thread. Core placement is left to
+    the OS: several plugin instances share the machine, and fixed cores
+    would stack their workers on the same ones.
+
+    Stalls: waiting for started tasks is bounded to half a block period.
+    A task that is already running can't be taken back, so past the bound
+    the caller still waits for it (yielding), and then runs the following
+    jobs inline for a while instead of handing them out.
+
+    NOTE: run() never allocates or blocks; it signals a worker's event only
+    if that worker went to sleep. Pool size changes (prepare/release) happen
+    on the message thread with processing stopped.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <cstdint>
+
+//==============================================================================
+class WorkerPool
+{
+public:
+    WorkerPool();
+    ~WorkerPool();
+
+    /**
+        Starts numWorkers threads (0 = everything runs on the caller), replacing
+        any previous ones. blockPeriodMs sizes the spin time, the stall bound
+        and the workers' realtime period. Message thread, processing stopped.
+    */
+    void prepare (int numWorkers, double blockPeriodMs);
+
+    /** Stops the workers (releaseResources, destruction). */
+    void release();
+
+    int getNumWorkers() const { return workers.size(); }
+
+    /** Worker count that leaves one core for the host's audio thread. */
+    static int getRecommendedNumWorkers (int numTaskGroups);
+
+    //==============================================================================
+    /**
+        Calls task (i) for i in [0, numTasks) on the workers and the calling
+        thread; returns when every call has finished. Audio thread.
+    */
+    template <typename Task>
+    void run (int numTasks, Task& task)
+    {
+        if (numTasks <= 1 || workers.isEmpty() || inlineJobsRemaining > 0)
+        {
+            if (inlineJobsRemaining > 0)
+                --inlineJobsRemaining;
+
+            for (int i = 0; i < numTasks; ++i)
+                task (i);
+
+            return;
+        }
+
+        runJob (numTasks, &task, [] (void* context, int index) { (*static_cast<Task*> (context)) (index); });
+    }
+
+private:
+    //==============================================================================
+    class Worker;
+    using TaskFunction = void (*) (void* context, int index);
+
+    void runJob (int numTasks, void* context, TaskFunction function);
+    bool runNextTask (uint32_t jobGeneration);
+    bool waitForJob (uint32_t& seenGeneration, Worker& worker);
+
+    // Job state: generation in the upper 32 bits, then the task count and the
+    // next task index (16 bits each). Published together, so a worker that
+    // woke late can never claim a task of a later job, nor check an index
+    // against a later job's task count.
+    static uint64_t makeJobState (uint32_t jobGeneration, int numTasks)
+    {
+        return (static_cast<uint64_t> (jobGeneration) << 32) | (static_cast<uint64_t> (numTasks) << 16);
+    }
+
+    static constexpr int maxTasks = 0xffff;
+    static constexpr double spinFraction = 0.75;        // Spin time after a job, in block periods (< 1)
+    static constexpr int inlineJobsAfterStall = 256;   // Jobs the caller runs alone after a stalled wait
+
+    alignas (64) std::atomic<uint64_t> jobState { 0 };
+    alignas (64) std::atomic<int> tasksDone { 0 };
+    std::atomic<void*> jobContext { nullptr };
+    std::atomic<TaskFunction> jobFunction { nullptr };
+    uint32_t generation = 0;        // Caller only
+    int inlineJobsRemaining = 0;    // Caller only
+
+    alignas (64) std::atomic<int> numSleeping { 0 };
+    juce::int64 spinTicks = 0;
+    juce::int64 waitTicks = 0;
+
+    juce::OwnedArray<Worker> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WorkerPool)
+};